@@ -82,6 +82,14 @@ function(hpx_perform_cxx_feature_tests)
 
   hpx_check_for_cxx17_std_scan(DEFINITIONS HPX_HAVE_CXX17_STD_SCAN_ALGORITHMS)
 
+  if(HPX_WITH_DATAPAR_STD_EXPERIMENTAL_SIMD)
+    hpx_check_for_cxx_std_experimental_simd(
+      DEFINITIONS HPX_HAVE_DATAPAR HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD
+      REQUIRED
+        "HPX_WITH_DATAPAR_STD_EXPERIMENTAL_SIMD needs a compiler providing <experimental/simd>"
+    )
+  endif()
+
   hpx_check_for_cxx17_std_nontype_template_parameter_auto(
     DEFINITIONS HPX_HAVE_CXX17_NONTYPE_TEMPLATE_PARAMETER_AUTO
   )
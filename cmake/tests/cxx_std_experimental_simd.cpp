@@ -0,0 +1,26 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <experimental/simd>
+
+int main()
+{
+    namespace stdx = std::experimental;
+
+    alignas(stdx::memory_alignment_v<stdx::native_simd<double>>) double
+        data[stdx::native_simd<double>::size()] = {};
+
+    stdx::native_simd<double> v(data, stdx::vector_aligned);
+    v += 1.0;
+    v.copy_to(data, stdx::vector_aligned);
+
+    return stdx::popcount(v == 1.0) ==
+            static_cast<int>(stdx::native_simd<double>::size()) ?
+        0 :
+        1;
+}
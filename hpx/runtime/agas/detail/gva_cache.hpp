@@ -0,0 +1,317 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2011 Bryce Lelbach
+//  Copyright (c) 2011-2020 Hartmut Kaiser
+//  Copyright (c) 2016 Thomas Heller
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/cache/clock_cache.hpp>
+#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The key of an entry in the AGAS address translation cache. A key refers
+    // to a range of global ids, a key with a count of one will compare equal
+    // to every range containing it.
+    struct gva_cache_key
+    {    // {{{ gva_cache_key implementation
+    private:
+        typedef std::pair<naming::gid_type, naming::gid_type> key_type;
+
+        key_type key_;
+
+    public:
+        gva_cache_key()
+          : key_()
+        {
+        }
+
+        explicit gva_cache_key(
+                naming::gid_type const& id, std::uint64_t count = 1)
+          : key_(naming::detail::get_stripped_gid(id),
+                naming::detail::get_stripped_gid(id) + (count - 1))
+        {
+            HPX_ASSERT(count);
+        }
+
+        naming::gid_type get_gid() const
+        {
+            return key_.first;
+        }
+
+        naming::gid_type get_last_gid() const
+        {
+            return key_.second;
+        }
+
+        std::uint64_t get_count() const
+        {
+            naming::gid_type const size = key_.second - key_.first;
+            HPX_ASSERT(size.get_msb() == 0);
+            return size.get_lsb();
+        }
+
+        friend bool operator<(
+            gva_cache_key const& lhs, gva_cache_key const& rhs)
+        {
+            return lhs.key_.second < rhs.key_.first;
+        }
+
+        friend bool operator==(
+            gva_cache_key const& lhs, gva_cache_key const& rhs)
+        {
+            // Direct hit
+            if (lhs.key_ == rhs.key_)
+            {
+                return true;
+            }
+
+            // Is lhs in rhs?
+            if (1 == lhs.get_count() && 1 != rhs.get_count())
+            {
+                return rhs.key_.first <= lhs.key_.first &&
+                    lhs.key_.second <= rhs.key_.second;
+            }
+
+            // Is rhs in lhs?
+            else if (1 != lhs.get_count() && 1 == rhs.get_count())
+            {
+                return lhs.key_.first <= rhs.key_.first &&
+                    rhs.key_.second <= lhs.key_.second;
+            }
+
+            return false;
+        }
+    }; // }}}
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The AGAS address translation cache.
+    //
+    // The cache is split into a number of shards, each of which is protected
+    // by its own lock. Global ids are assigned to shards in blocks of
+    // consecutive ids, a range of ids is stored in all shards any of its
+    // blocks maps to. This way a lookup has to inspect one shard only. The
+    // shards use CLOCK replacement, cache hits do not modify the structure
+    // of a shard.
+    class gva_cache
+    {
+    public:
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        typedef hpx::util::cache::clock_cache<
+            gva_cache_key
+          , gva
+          , hpx::util::cache::statistics::local_full_statistics
+        > shard_cache_type;
+        typedef shard_cache_type::entry_type entry_type;
+        typedef shard_cache_type::statistics_type statistics_type;
+
+    private:
+        // number of consecutive global ids assigned to the same shard
+        static constexpr std::size_t block_size_log2 = 4;
+
+        struct shard
+        {
+            mutex_type mtx_;
+            shard_cache_type cache_;
+        };
+        typedef hpx::util::cache_aligned_data_derived<shard> shard_type;
+
+    public:
+        // The number of shards is rounded up to the next power of two.
+        explicit gva_cache(std::size_t num_shards = 1)
+          : shards_(round_up_to_power_of_two(num_shards))
+          , shift_(64 - log2(shards_.size()))
+        {
+        }
+
+        std::size_t num_shards() const
+        {
+            return shards_.size();
+        }
+
+        // Change the overall number of entries this cache can hold
+        void reserve(std::size_t cache_size)
+        {
+            std::size_t shard_size =
+                (cache_size + shards_.size() - 1) / shards_.size();
+            if (shard_size == 0)
+                shard_size = 1;
+
+            for (shard& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.cache_.reserve(shard_size);
+            }
+        }
+
+        // Return the number of entries held by all shards, ranges stored in
+        // more than one shard are counted more than once.
+        std::size_t size()
+        {
+            std::size_t result = 0;
+            for (shard& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += s.cache_.size();
+            }
+            return result;
+        }
+
+        // Look up the entry the given (single) global id is part of
+        bool get_entry(gva_cache_key const& key, gva_cache_key& realkey,
+            entry_type& entry)
+        {
+            shard& s = shards_[get_shard_index(key.get_gid())];
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.cache_.get_entry(key, realkey, entry);
+        }
+
+        // Update (or add) the given entry in every shard the range of ids
+        // maps to. Returns false if the update did not succeed for at least
+        // one shard, see clock_cache::update_if.
+        template <typename F>
+        bool update_if(gva_cache_key const& key, entry_type const& entry, F f)
+        {
+            bool result = true;
+            for_each_shard(key, [&](shard& s) {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                if (!s.cache_.update_if(key, entry, f))
+                    result = false;
+            });
+            return result;
+        }
+
+        // Remove all entries for which the given predicate returns true
+        template <typename Func>
+        std::size_t erase(Func const& ep)
+        {
+            std::size_t result = 0;
+            for (shard& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += s.cache_.erase(ep);
+            }
+            return result;
+        }
+
+        void clear()
+        {
+            for (shard& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.cache_.clear();
+            }
+        }
+
+        // Accumulate the given statistics over all shards, for instance:
+        //
+        //      cache.get_statistics(&statistics_type::hits, reset);
+        //
+        template <typename R, typename Statistics>
+        std::int64_t get_statistics(R (Statistics::*f)(bool), bool reset)
+        {
+            std::int64_t result = 0;
+            for (shard& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += static_cast<std::int64_t>(
+                    (s.cache_.get_statistics().*f)(reset));
+            }
+            return result;
+        }
+
+    private:
+        static std::size_t round_up_to_power_of_two(std::size_t n)
+        {
+            std::size_t result = 1;
+            while (result < n)
+                result <<= 1;
+            return result;
+        }
+
+        static std::size_t log2(std::size_t n)
+        {
+            std::size_t result = 0;
+            while ((std::size_t(1) << result) < n)
+                ++result;
+            return result;
+        }
+
+        std::size_t get_shard_index(
+            std::uint64_t msb, std::uint64_t block) const
+        {
+            if (shards_.size() == 1)
+                return 0;
+
+            // Fibonacci hashing of the block number
+            std::uint64_t const h =
+                (msb ^ block) * std::uint64_t(0x9e3779b97f4a7c15ull);
+            return static_cast<std::size_t>(h >> shift_);
+        }
+
+        std::size_t get_shard_index(naming::gid_type const& id) const
+        {
+            return get_shard_index(
+                id.get_msb(), id.get_lsb() >> block_size_log2);
+        }
+
+        template <typename F>
+        void for_each_shard(gva_cache_key const& key, F&& f)
+        {
+            naming::gid_type const first = key.get_gid();
+            naming::gid_type const last = key.get_last_gid();
+
+            std::uint64_t const first_block =
+                first.get_lsb() >> block_size_log2;
+            std::uint64_t const last_block = last.get_lsb() >> block_size_log2;
+
+            // the range covers at least one block per shard
+            if (first.get_msb() != last.get_msb() ||
+                last_block - first_block >= shards_.size())
+            {
+                for (shard& s : shards_)
+                    f(s);
+                return;
+            }
+
+            // visit each shard only once (if there are too many shards to
+            // keep track of, updating a shard twice does no harm)
+            std::uint64_t visited = 0;
+            for (std::uint64_t b = first_block; b <= last_block; ++b)
+            {
+                std::size_t const i = get_shard_index(first.get_msb(), b);
+                if (i < 64)
+                {
+                    std::uint64_t const mask = std::uint64_t(1) << i;
+                    if ((visited & mask) != 0)
+                        continue;
+                    visited |= mask;
+                }
+                f(shards_[i]);
+            }
+        }
+
+        std::vector<shard_type> shards_;
+        std::size_t const shift_;
+    };
+}}}
@@ -0,0 +1,155 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The queue of parcels waiting to be sent to one destination locality.
+    //
+    // Any number of threads may enqueue parcels concurrently without taking
+    // a lock (this is an intrusive multi-producer/single-consumer queue as
+    // described by D. Vyukov). Parcels are dequeued by whatever thread
+    // acquired a connection to the destination; try_lock() makes sure that
+    // at most one of those is dequeuing at any point in time.
+    class HPX_EXPORT pending_parcels_queue
+    {
+    private:
+        HPX_NON_COPYABLE(pending_parcels_queue);
+
+        struct node
+        {
+            node()
+              : next_(nullptr)
+            {}
+
+            node(parcel&& p, write_handler_type&& f)
+              : parcel_(std::move(p))
+              , handler_(std::move(f))
+              , next_(nullptr)
+            {}
+
+            parcel parcel_;
+            write_handler_type handler_;
+            std::atomic<node*> next_;
+        };
+
+    public:
+        explicit pending_parcels_queue(locality const& dest);
+        ~pending_parcels_queue();
+
+        locality const& destination() const
+        {
+            return dest_;
+        }
+
+        // Add parcels to the end of the queue, may be called concurrently
+        void push(parcel&& p, write_handler_type&& f);
+        void push(std::vector<parcel>&& parcels,
+            std::vector<write_handler_type>&& handlers);
+
+        // Gain exclusive access to the consumer end of the queue
+        bool try_lock()
+        {
+            if (!consumer_busy_.load(std::memory_order_relaxed) &&
+                !consumer_busy_.exchange(true, std::memory_order_acquire))
+            {
+                return true;
+            }
+            ++contentions_;
+            return false;
+        }
+
+        void unlock()
+        {
+            consumer_busy_.store(false, std::memory_order_release);
+        }
+
+        // Remove all (or the first) of the parcels from the queue, the caller
+        // must own the consumer lock
+        std::size_t pop_all(std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers);
+        bool pop(parcel& p, write_handler_type& f);
+
+        std::size_t size() const
+        {
+            return size_.load(std::memory_order_seq_cst);
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        // Manage the membership of this queue in the set of destinations
+        // which have parcels pending. mark_pending() returns true if the
+        // queue was not a member before.
+        bool mark_pending()
+        {
+            return !pending_.exchange(true, std::memory_order_seq_cst);
+        }
+
+        void clear_pending()
+        {
+            pending_.store(false, std::memory_order_seq_cst);
+        }
+
+        // statistics
+        std::int64_t get_enqueued(bool reset)
+        {
+            return util::get_and_reset_value(enqueued_, reset);
+        }
+
+        std::int64_t get_dequeued(bool reset)
+        {
+            return util::get_and_reset_value(dequeued_, reset);
+        }
+
+        std::int64_t get_contentions(bool reset)
+        {
+            return util::get_and_reset_value(contentions_, reset);
+        }
+
+    private:
+        void push_chain(node* first, node* last);
+        node* pop_node();
+
+        locality const dest_;
+
+        // producers only touch head_, the consumer owns tail_
+        std::atomic<node*> head_;
+        node* tail_;
+        node stub_;
+
+        std::atomic<std::size_t> size_;
+        std::atomic<bool> consumer_busy_;
+        std::atomic<bool> pending_;
+
+        std::atomic<std::int64_t> enqueued_;
+        std::atomic<std::int64_t> dequeued_;
+        std::atomic<std::int64_t> contentions_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
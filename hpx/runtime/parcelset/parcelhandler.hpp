@@ -396,6 +396,10 @@ namespace hpx { namespace parcelset
         std::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
 
+        //
+        std::int64_t get_pending_parcels_statistics(std::string const& pp_type,
+            parcelport::pending_parcels_statistics_type stat_type, bool) const;
+
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
             std::string const& ppname, int priority, bool bootstrap) const;
@@ -433,6 +437,7 @@ namespace hpx { namespace parcelset
 
         void register_counter_types(std::string const& pp_type);
         void register_connection_cache_counter_types(std::string const& pp_type);
+        void register_pending_parcels_counter_types(std::string const& pp_type);
 
     private:
         int get_priority(std::string const& name) const
@@ -21,14 +21,16 @@
 #include <hpx/performance_counters/parcels/gatherer.hpp>
 #include <hpx/async_distributed/applier_fwd.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/runtime/parcelset/detail/pending_parcels_queue.hpp>
 #include <hpx/runtime/parcelset/detail/per_action_data_counter.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 
+#include <boost/lockfree/stack.hpp>
+
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
@@ -174,6 +176,14 @@ namespace hpx { namespace parcelset
             connection_cache_reclaims = 4
         };
 
+        /// Return the given statistic of the queues of pending parcels
+        enum pending_parcels_statistics_type
+        {
+            pending_parcels_enqueued = 0,
+            pending_parcels_dequeued = 1,
+            pending_parcels_contentions = 2
+        };
+
         // invoke pending background work
         virtual bool do_background_work(
             std::size_t num_thread, parcelport_background_mode mode) = 0;
@@ -247,6 +257,10 @@ namespace hpx { namespace parcelset
 
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
+        /// accumulated statistics of all queues of pending parcels
+        std::int64_t get_pending_parcels_statistics(
+            pending_parcels_statistics_type stat_type, bool reset);
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -329,21 +343,49 @@ namespace hpx { namespace parcelset
         void early_pending_parcel_handler(boost::system::error_code const& ec,
             parcel const & p);
 
+    protected:
+        /// Return the queue of parcels pending for the given destination,
+        /// create a new one if necessary
+        detail::pending_parcels_queue& get_pending_parcels_queue(
+            locality const& dest);
+
+        /// Return the queue of parcels pending for the given destination,
+        /// or nullptr if there is none
+        detail::pending_parcels_queue* find_pending_parcels_queue(
+            locality const& dest) const;
+
+        /// Add the given queue to the set of destinations with parcels
+        /// pending (if it is not a member already)
+        void add_pending_parcels_destination(
+            detail::pending_parcels_queue& q);
+
+        /// Collect all destinations which still have parcels pending
+        void get_pending_parcels_destinations(
+            std::vector<locality>& destinations);
+
     protected:
         /// mutex for all of the member data
         mutable lcos::local::spinlock mtx_;
 
         hpx::applier::applier *applier_;
 
-        /// The cache for pending parcels
-        typedef hpx::tuple<
-            std::vector<parcel>
-          , std::vector<write_handler_type>
-        > map_second_type;
-        typedef std::map<locality, map_second_type> pending_parcels_map;
-        pending_parcels_map pending_parcels_;
-
-        typedef std::set<locality> pending_parcels_destinations;
+        /// The queues of pending parcels, one for each destination. Lookups
+        /// use an immutable array of all queues (sorted by destination),
+        /// which is replaced (under mtx_) whenever a new queue is added.
+        /// Neither the queues nor the arrays are released before the
+        /// parcelport is destroyed, as lookups don't hold any lock.
+        typedef std::vector<detail::pending_parcels_queue*>
+            pending_parcels_queues;
+
+        std::atomic<pending_parcels_queues const*> pending_parcels_queues_;
+        std::vector<std::unique_ptr<pending_parcels_queues const>>
+            pending_parcels_queues_storage_;
+        std::vector<std::unique_ptr<detail::pending_parcels_queue>>
+            pending_parcels_storage_;
+
+        /// The destinations which have parcels pending
+        typedef boost::lockfree::stack<detail::pending_parcels_queue*>
+            pending_parcels_destinations;
         pending_parcels_destinations parcel_destinations_;
         std::atomic<std::uint32_t> num_parcel_destinations_;
 
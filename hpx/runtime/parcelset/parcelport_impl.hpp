@@ -20,6 +20,7 @@
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime/parcelset/detail/call_for_each.hpp>
 #include <hpx/runtime/parcelset/detail/parcel_await.hpp>
+#include <hpx/runtime/parcelset/detail/pending_parcels_queue.hpp>
 #include <hpx/runtime/parcelset/encode_parcels.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/modules/threading.hpp>
@@ -617,132 +618,64 @@ namespace hpx { namespace parcelset
         void enqueue_parcel(locality const& locality_id,
             parcel&& p, write_handler_type&& f)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
+            detail::pending_parcels_queue& q =
+                get_pending_parcels_queue(locality_id);
 
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking<
-                std::unique_lock<lcos::local::spinlock>
-            > il(&l);
-
-            mapped_type& e = pending_parcels_[locality_id];
-            hpx::get<0>(e).push_back(std::move(p));
-            hpx::get<1>(e).push_back(std::move(f));
-
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+            q.push(std::move(p), std::move(f));
+            add_pending_parcels_destination(q);
         }
 
         void enqueue_parcels(locality const& locality_id,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
-
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking<
-                std::unique_lock<lcos::local::spinlock>
-            > il(&l);
-
             HPX_ASSERT(parcels.size() == handlers.size());
 
-            mapped_type& e = pending_parcels_[locality_id];
-            if (hpx::get<0>(e).empty())
-            {
-                HPX_ASSERT(hpx::get<1>(e).empty());
-                std::swap(hpx::get<0>(e), parcels);
-                std::swap(hpx::get<1>(e), handlers);
-            }
-            else
-            {
-                HPX_ASSERT(hpx::get<0>(e).size() == hpx::get<1>(e).size());
-                std::size_t new_size = hpx::get<0>(e).size() + parcels.size();
-                hpx::get<0>(e).reserve(new_size);
-
-                std::move(parcels.begin(), parcels.end(),
-                    std::back_inserter(hpx::get<0>(e)));
-                hpx::get<1>(e).reserve(new_size);
-                std::move(handlers.begin(), handlers.end(),
-                    std::back_inserter(hpx::get<1>(e)));
-            }
+            detail::pending_parcels_queue& q =
+                get_pending_parcels_queue(locality_id);
 
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+            q.push(std::move(parcels), std::move(handlers));
+            add_pending_parcels_destination(q);
         }
 
         bool dequeue_parcels(locality const& locality_id,
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers)
         {
-            using iterator = pending_parcels_map::iterator;
-
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
-
-                if (!l) return false;
+            HPX_ASSERT(handlers.size() == 0);
+            HPX_ASSERT(handlers.size() == parcels.size());
 
-                iterator it = pending_parcels_.find(locality_id);
-
-                // do nothing if parcels have already been picked up by
-                // another thread
-                if (it != pending_parcels_.end() && !hpx::get<0>(it->second).empty())
-                {
-                    HPX_ASSERT(it->first == locality_id);
-                    HPX_ASSERT(handlers.size() == 0);
-                    HPX_ASSERT(handlers.size() == parcels.size());
-                    std::swap(parcels, hpx::get<0>(it->second));
-                    HPX_ASSERT(hpx::get<0>(it->second).size() == 0);
-                    std::swap(handlers, hpx::get<1>(it->second));
-                    HPX_ASSERT(handlers.size() == parcels.size());
-
-                    HPX_ASSERT(!handlers.empty());
-                }
-                else
-                {
-                    HPX_ASSERT(hpx::get<1>(it->second).empty());
-                    return false;
-                }
+            detail::pending_parcels_queue* q =
+                find_pending_parcels_queue(locality_id);
 
-                parcel_destinations_.erase(locality_id);
+            // do nothing if parcels have already been picked up by
+            // another thread
+            if (q == nullptr || q->empty() || !q->try_lock())
+                return false;
 
-                HPX_ASSERT(0 != num_parcel_destinations_.load());
-                --num_parcel_destinations_;
+            std::size_t num_parcels = q->pop_all(parcels, handlers);
+            q->unlock();
 
-                return true;
-            }
+            HPX_ASSERT(handlers.size() == parcels.size());
+            return num_parcels != 0;
         }
 
     protected:
         bool dequeue_parcel(locality& dest, parcel& p, write_handler_type& handler)
         {
+            for (detail::pending_parcels_queue* q :
+                *pending_parcels_queues_.load(std::memory_order_acquire))
             {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
+                if (q->empty() || !q->try_lock())
+                    continue;
 
-                if (!l) return false;
+                bool result = q->pop(p, handler);
+                q->unlock();
 
-                for (auto &pending: pending_parcels_)
+                if (result)
                 {
-                    auto &parcels = hpx::get<0>(pending.second);
-                    if (!parcels.empty())
-                    {
-                        auto& handlers = hpx::get<1>(pending.second);
-                        dest = pending.first;
-                        p = std::move(parcels.back());
-                        parcels.pop_back();
-                        handler = std::move(handlers.back());
-                        handlers.pop_back();
-
-                        if (parcels.empty())
-                        {
-                            pending_parcels_.erase(dest);
-                        }
-                        return true;
-                    }
+                    dest = q->destination();
+                    return true;
                 }
             }
             return false;
@@ -754,21 +687,7 @@ namespace hpx { namespace parcelset
                 return true;
 
             std::vector<locality> destinations;
-
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
-                if(l.owns_lock())
-                {
-                    if (parcel_destinations_.empty())
-                        return true;
-
-                    destinations.reserve(parcel_destinations_.size());
-                    for (locality const& loc : parcel_destinations_)
-                    {
-                        destinations.push_back(loc);
-                    }
-                }
-            }
+            get_pending_parcels_destinations(destinations);
 
             // Create new HPX threads which send the parcels that are still
             // pending.
@@ -860,11 +779,10 @@ namespace hpx { namespace parcelset
                 connection_cache_.clear(locality_id, sender_connection);
             }
             {
-                std::lock_guard<lcos::local::spinlock> l(mtx_);
-
 //                HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it = pending_parcels_.find(locality_id);
-                if (it == pending_parcels_.end() || hpx::get<0>(it->second).empty())
+                detail::pending_parcels_queue* q =
+                    find_pending_parcels_queue(locality_id);
+                if (q == nullptr || q->empty())
                     return;
             }
 
@@ -0,0 +1,160 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/clock_cache.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data(char const* const k, char const* const v)
+      : key(k)
+      , value(v)
+    {
+    }
+
+    char const* const key;
+    char const* const value;
+};
+
+data cache_entries[] = {data("white", "255,255,255"),
+    data("yellow", "255,255,0"), data("green", "0,255,0"),
+    data("blue", "0,0,255"), data("magenta", "255,0,255"),
+    data("black", "0,0,0"), data(nullptr, nullptr)};
+
+typedef hpx::util::cache::clock_cache<std::string, std::string,
+    hpx::util::cache::statistics::local_statistics>
+    cache_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_insert()
+{
+    cache_type c(3);
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.capacity());
+
+    // insert all items into the cache
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(3));
+    }
+
+    // there should be 3 items in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    // the last item inserted is never evicted right away
+    std::string black;
+    HPX_TEST(c.get_entry("black", black));
+    HPX_TEST_EQ(black, "0,0,0");
+
+    // an existing key can't be inserted again
+    HPX_TEST(!c.insert("black", "0,0,1"));
+
+    HPX_TEST_EQ(
+        static_cast<std::size_t>(3), c.get_statistics().evictions(false));
+    HPX_TEST_EQ(
+        static_cast<std::size_t>(6), c.get_statistics().insertions(false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_insert_with_touch()
+{
+    cache_type c(3);
+
+    // insert 3 items into the cache
+    int i = 0;
+    data* d = &cache_entries[0];
+
+    for (/**/; i < 3 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    // Inserting the next item sweeps over all entries (clearing their marks)
+    // and evicts the first one visited.
+    HPX_TEST(c.insert(d->key, d->value));
+    ++d;
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    // 'green' was evicted, now touch all of the remaining items, except
+    // 'yellow'
+    HPX_TEST(!c.holds_key("green"));
+
+    std::string value;
+    HPX_TEST(c.get_entry("blue", value));
+    HPX_TEST(c.get_entry("white", value));
+    HPX_TEST_EQ(value, "255,255,255");
+
+    // the next insertion has to evict the only unmarked entry
+    HPX_TEST(c.insert(d->key, d->value));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(c.holds_key("blue"));
+    HPX_TEST(c.holds_key("magenta"));
+    HPX_TEST(!c.holds_key("yellow"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_update_and_erase()
+{
+    cache_type c(0);    // no size limitation
+
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        c.update(d->key, d->value);
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(6), c.size());
+
+    c.update("white", "254,254,254");
+
+    std::string white;
+    HPX_TEST(c.get_entry("white", white));
+    HPX_TEST_EQ(white, "254,254,254");
+
+    // update_if does not replace the value if the predicate returns true
+    HPX_TEST(!c.update_if("white", "0,0,0",
+        [](std::string const&, std::string const&) { return true; }));
+    HPX_TEST(c.get_entry("white", white));
+    HPX_TEST_EQ(white, "254,254,254");
+
+    HPX_TEST(c.update_if("white", "255,255,255",
+        [](std::string const&, std::string const&) { return false; }));
+    HPX_TEST(c.get_entry("white", white));
+    HPX_TEST_EQ(white, "255,255,255");
+
+    // remove all entries whose name starts with a 'b'
+    std::size_t erased =
+        c.erase([](std::pair<std::string, std::string> const& p) {
+            return p.first[0] == 'b';
+        });
+    HPX_TEST_EQ(static_cast<std::size_t>(2), erased);
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(4), c.size());
+
+    // shrinking the cache evicts entries
+    c.reserve(2);
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(2), c.size());
+
+    c.clear();
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_clock_insert();
+    test_clock_insert_with_touch();
+    test_clock_update_and_erase();
+
+    return hpx::util::report_errors();
+}
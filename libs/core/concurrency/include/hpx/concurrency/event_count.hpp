@@ -0,0 +1,107 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#if !defined(__linux__)
+#include <condition_variable>
+#include <mutex>
+#endif
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace concurrency {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // An event count allows threads to block until some condition becomes
+    // true without requiring the notifying side to take a lock. A waiting
+    // thread announces itself, checks the condition and only then blocks:
+    //
+    //      if (!condition())
+    //      {
+    //          auto key = ec.prepare_wait();
+    //          if (condition())
+    //              ec.cancel_wait();
+    //          else
+    //              ec.wait(key, timeout);
+    //      }
+    //
+    // The notifying side makes the condition true and calls notify_one or
+    // notify_all, which is cheap if no thread is waiting. On Linux waiting
+    // threads block on a futex, notify_one wakes exactly one of them.
+    class HPX_CORE_EXPORT event_count
+    {
+    public:
+        typedef std::uint32_t key_type;
+
+        event_count()
+          : epoch_(0)
+          , waiters_(0)
+        {
+        }
+
+        event_count(event_count const&) = delete;
+        event_count& operator=(event_count const&) = delete;
+
+        // Announce that the calling thread is about to wait, the returned key
+        // has to be passed to wait.
+        key_type prepare_wait() noexcept
+        {
+            waiters_.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return epoch_.load(std::memory_order_acquire);
+        }
+
+        // Retract a prior call to prepare_wait without blocking.
+        void cancel_wait() noexcept
+        {
+            waiters_.fetch_sub(1, std::memory_order_seq_cst);
+        }
+
+        // Block until notified (after prepare_wait returned the given key)
+        // or until the timeout expired. Returns false on timeout.
+        bool wait(key_type key, std::chrono::nanoseconds timeout);
+
+        // Wake one waiting thread, if any.
+        void notify_one() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters_.load(std::memory_order_relaxed) != 0)
+                notify(false);
+        }
+
+        // Wake all waiting threads.
+        void notify_all() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters_.load(std::memory_order_relaxed) != 0)
+                notify(true);
+        }
+
+        // Return the (approximate) number of waiting threads
+        std::uint32_t num_waiters() const noexcept
+        {
+            return waiters_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void notify(bool all) noexcept;
+
+        std::atomic<std::uint32_t> epoch_;
+        std::atomic<std::uint32_t> waiters_;
+#if !defined(__linux__)
+        std::mutex mtx_;
+        std::condition_variable cond_;
+#endif
+    };
+}}    // namespace hpx::concurrency
+
+#include <hpx/config/warnings_suffix.hpp>
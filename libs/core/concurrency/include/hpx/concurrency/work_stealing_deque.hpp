@@ -0,0 +1,202 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace concurrency {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A Chase-Lev work-stealing deque (see D. Chase and Y. Lev, "Dynamic
+    // Circular Work-Stealing Deque", SPAA 2005, and N. M. Le et al.,
+    // "Correct and Efficient Work-Stealing for Weak Memory Models",
+    // PPoPP 2013).
+    //
+    // The owning thread pushes and pops items at the bottom of the deque
+    // (LIFO), any other thread may concurrently steal items from the top of
+    // the deque (FIFO). The buffer grows as needed, retired buffers are kept
+    // alive until the deque is destroyed as concurrent thieves might still
+    // read from them.
+    template <typename T>
+    class work_stealing_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "work_stealing_deque supports trivially copyable types only");
+
+        struct buffer
+        {
+            explicit buffer(std::int64_t capacity)
+              : mask_(capacity - 1)
+              , data_(new std::atomic<T>[std::size_t(capacity)])
+            {
+                HPX_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0);
+            }
+
+            ~buffer()
+            {
+                delete[] data_;
+            }
+
+            std::int64_t capacity() const
+            {
+                return mask_ + 1;
+            }
+
+            T get(std::int64_t i) const
+            {
+                return data_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T const& val)
+            {
+                data_[i & mask_].store(val, std::memory_order_relaxed);
+            }
+
+            std::int64_t const mask_;
+            std::atomic<T>* data_;
+        };
+
+        static std::int64_t round_up_to_power_of_two(std::size_t n)
+        {
+            std::int64_t result = 16;
+            while (result < std::int64_t(n))
+                result <<= 1;
+            return result;
+        }
+
+    public:
+        explicit work_stealing_deque(std::size_t initial_size = 0)
+          : buffer_(new buffer(round_up_to_power_of_two(initial_size)))
+        {
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+            buffers_.push_back(buffer_.load(std::memory_order_relaxed));
+        }
+
+        work_stealing_deque(work_stealing_deque const&) = delete;
+        work_stealing_deque& operator=(work_stealing_deque const&) = delete;
+
+        ~work_stealing_deque()
+        {
+            for (buffer* b : buffers_)
+                delete b;
+        }
+
+        // Add an item at the bottom of the deque, may be called by the
+        // owning thread only.
+        void push(T const& val)
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_acquire);
+
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+            if (b - t > a->capacity() - 1)
+                a = grow(a, t, b);
+
+            a->put(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Remove the most recently pushed item, may be called by the owning
+        // thread only.
+        bool pop(T& val)
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed) - 1;
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            val = a->get(b);
+            if (t == b)
+            {
+                // this is the last item, race against the thieves
+                bool const success = top_.data_.compare_exchange_strong(t,
+                    t + 1, std::memory_order_seq_cst,
+                    std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return success;
+            }
+            return true;
+        }
+
+        // Remove the least recently pushed item, may be called by any thread.
+        // This may fail spuriously if other threads concurrently remove items.
+        bool steal(T& val)
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+                return false;
+
+            buffer* a = buffer_.load(std::memory_order_acquire);
+            T const result = a->get(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            val = result;
+            return true;
+        }
+
+        // Return the (approximate) number of items held by the deque
+        std::size_t size() const
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? std::size_t(b - t) : 0;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+    private:
+        buffer* grow(buffer* a, std::int64_t t, std::int64_t b)
+        {
+            buffer* new_buffer = new buffer(2 * a->capacity());
+            for (std::int64_t i = t; i != b; ++i)
+                new_buffer->put(i, a->get(i));
+
+            // the old buffer is kept alive, only the owner accesses the list
+            // of buffers
+            buffers_.push_back(new_buffer);
+            buffer_.store(new_buffer, std::memory_order_release);
+            return new_buffer;
+        }
+
+        hpx::util::cache_aligned_data<std::atomic<std::int64_t>> top_;
+        hpx::util::cache_aligned_data<std::atomic<std::int64_t>> bottom_;
+        std::atomic<buffer*> buffer_;
+        std::vector<buffer*> buffers_;
+    };
+}}    // namespace hpx::concurrency
@@ -0,0 +1,111 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/event_count.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <ctime>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace hpx { namespace concurrency {
+
+#if defined(__linux__)
+    namespace {
+        static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(int),
+            "futex operations require 32 bit atomics");
+
+        long futex_wait(std::atomic<std::uint32_t>* addr, std::uint32_t value,
+            std::chrono::nanoseconds timeout)
+        {
+            std::chrono::seconds const secs =
+                std::chrono::duration_cast<std::chrono::seconds>(timeout);
+
+            timespec ts;
+            ts.tv_sec = static_cast<std::time_t>(secs.count());
+            ts.tv_nsec = static_cast<long>((timeout - secs).count());
+
+            return syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(addr),
+                FUTEX_WAIT_PRIVATE, value, &ts, nullptr, 0);
+        }
+
+        void futex_wake(std::atomic<std::uint32_t>* addr, int count)
+        {
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(addr),
+                FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+        }
+    }    // namespace
+#endif
+
+    bool event_count::wait(key_type key, std::chrono::nanoseconds timeout)
+    {
+        bool notified = true;
+
+#if defined(__linux__)
+        auto const deadline = std::chrono::steady_clock::now() + timeout;
+        while (epoch_.load(std::memory_order_acquire) == key)
+        {
+            auto const remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining <= std::chrono::nanoseconds(0))
+            {
+                notified = false;
+                break;
+            }
+
+            // spurious wake-ups and EINTR are handled by re-checking the epoch
+            if (futex_wait(&epoch_, key,
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        remaining)) == -1 &&
+                errno == ETIMEDOUT)
+            {
+                notified = epoch_.load(std::memory_order_acquire) != key;
+                break;
+            }
+        }
+#else
+        {
+            std::unique_lock<std::mutex> l(mtx_);
+            notified = cond_.wait_for(l, timeout, [&]() {
+                return epoch_.load(std::memory_order_acquire) != key;
+            });
+        }
+#endif
+
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+        return notified;
+    }
+
+    void event_count::notify(bool all) noexcept
+    {
+        epoch_.fetch_add(1, std::memory_order_acq_rel);
+
+#if defined(__linux__)
+        futex_wake(&epoch_, all ? INT_MAX : 1);
+#else
+        {
+            // synchronize with threads about to block on the condition
+            std::lock_guard<std::mutex> l(mtx_);
+        }
+        if (all)
+            cond_.notify_all();
+        else
+            cond_.notify_one();
+#endif
+    }
+}}    // namespace hpx::concurrency
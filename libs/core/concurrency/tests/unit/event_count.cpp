@@ -0,0 +1,162 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/event_count.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+std::uint64_t threads = 4;
+std::uint64_t items = 100000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_timeout()
+{
+    hpx::concurrency::event_count ec;
+
+    auto key = ec.prepare_wait();
+    HPX_TEST_EQ(ec.num_waiters(), std::uint32_t(1));
+
+    // nobody notifies, the wait has to time out
+    HPX_TEST(!ec.wait(key, std::chrono::milliseconds(10)));
+    HPX_TEST_EQ(ec.num_waiters(), std::uint32_t(0));
+
+    // a notification between prepare_wait and wait is not lost
+    key = ec.prepare_wait();
+    ec.notify_one();
+    HPX_TEST(ec.wait(key, std::chrono::seconds(10)));
+
+    // cancel_wait retracts prepare_wait
+    ec.prepare_wait();
+    ec.cancel_wait();
+    HPX_TEST_EQ(ec.num_waiters(), std::uint32_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Consumers take items from a shared counter and block on the event count if
+// nothing is available, the producer notifies one consumer per item.
+void test_producer_consumer()
+{
+    hpx::concurrency::event_count ec;
+
+    std::atomic<std::int64_t> available(0);
+    std::atomic<std::uint64_t> consumed(0);
+    std::atomic<bool> done(false);
+
+    auto try_consume = [&]() {
+        std::int64_t n = available.load(std::memory_order_acquire);
+        while (n > 0)
+        {
+            if (available.compare_exchange_weak(n, n - 1))
+            {
+                ++consumed;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::vector<std::thread> consumers;
+    for (std::uint64_t t = 1; t < threads; ++t)
+    {
+        consumers.emplace_back([&]() {
+            while (true)
+            {
+                if (try_consume())
+                    continue;
+
+                if (done.load(std::memory_order_acquire))
+                    break;
+
+                auto key = ec.prepare_wait();
+                if (available.load(std::memory_order_acquire) > 0 ||
+                    done.load(std::memory_order_acquire))
+                {
+                    ec.cancel_wait();
+                    continue;
+                }
+
+                // the timeout is generous, hitting it means that a
+                // notification got lost
+                HPX_TEST(ec.wait(key, std::chrono::seconds(10)));
+            }
+        });
+    }
+
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        available.fetch_add(1, std::memory_order_release);
+        ec.notify_one();
+    }
+
+    done.store(true, std::memory_order_release);
+    ec.notify_all();
+
+    // consume everything left over if there are no consumers
+    while (try_consume())
+        ;
+
+    for (std::thread& t : consumers)
+        t.join();
+
+    HPX_TEST_EQ(consumed.load(), items);
+    HPX_TEST_EQ(ec.num_waiters(), std::uint32_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv)
+{
+    using hpx::program_options::command_line_parser;
+    using hpx::program_options::notify;
+    using hpx::program_options::options_description;
+    using hpx::program_options::store;
+    using hpx::program_options::value;
+    using hpx::program_options::variables_map;
+
+    variables_map vm;
+
+    options_description desc_cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(4),
+         "the number of threads using the event count (one producer, the "
+         "remaining ones are consuming)")
+        ("items,i", value<std::uint64_t>(&items)->default_value(100000),
+         "the number of items to produce")
+    ;
+    // clang-format on
+
+    store(command_line_parser(argc, argv)
+              .options(desc_cmdline)
+              .allow_unregistered()
+              .run(),
+        vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return hpx::util::report_errors();
+    }
+
+    test_timeout();
+    test_producer_consumer();
+
+    return hpx::util::report_errors();
+}
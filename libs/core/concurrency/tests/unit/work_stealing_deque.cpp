@@ -0,0 +1,143 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/work_stealing_deque.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+std::uint64_t threads = 2;
+std::uint64_t items = 500000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_single_threaded()
+{
+    // start small to force the buffer to grow
+    hpx::concurrency::work_stealing_deque<std::uint64_t> deque(2);
+    HPX_TEST(deque.empty());
+
+    for (std::uint64_t i = 0; i != 100; ++i)
+        deque.push(i);
+    HPX_TEST_EQ(deque.size(), std::size_t(100));
+
+    // the owner takes the most recently pushed item
+    std::uint64_t value = 0;
+    HPX_TEST(deque.pop(value));
+    HPX_TEST_EQ(value, std::uint64_t(99));
+
+    // thieves take the least recently pushed item
+    HPX_TEST(deque.steal(value));
+    HPX_TEST_EQ(value, std::uint64_t(0));
+
+    for (std::uint64_t i = 98; i != 0; --i)
+    {
+        HPX_TEST(deque.pop(value));
+        HPX_TEST_EQ(value, i);
+    }
+
+    HPX_TEST(deque.empty());
+    HPX_TEST(!deque.pop(value));
+    HPX_TEST(!deque.steal(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_steal()
+{
+    hpx::concurrency::work_stealing_deque<std::uint64_t> deque;
+
+    std::vector<std::atomic<int>> seen(items);
+    for (auto& s : seen)
+        s.store(0);
+
+    std::atomic<bool> done(false);
+
+    std::vector<std::thread> thieves;
+    for (std::uint64_t t = 1; t < threads; ++t)
+    {
+        thieves.emplace_back([&]() {
+            std::uint64_t value = 0;
+            while (!done.load(std::memory_order_acquire) || !deque.empty())
+            {
+                if (deque.steal(value))
+                    ++seen[value];
+            }
+        });
+    }
+
+    // the owner pushes all items and pops every second one
+    std::uint64_t value = 0;
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        deque.push(i);
+        if ((i % 2) == 1 && deque.pop(value))
+            ++seen[value];
+    }
+    while (deque.pop(value))
+        ++seen[value];
+
+    done.store(true, std::memory_order_release);
+    for (std::thread& t : thieves)
+        t.join();
+
+    // every item has to be taken exactly once
+    for (std::uint64_t i = 0; i != items; ++i)
+        HPX_TEST_EQ(seen[i].load(), 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv)
+{
+    using hpx::program_options::command_line_parser;
+    using hpx::program_options::notify;
+    using hpx::program_options::options_description;
+    using hpx::program_options::store;
+    using hpx::program_options::value;
+    using hpx::program_options::variables_map;
+
+    variables_map vm;
+
+    options_description desc_cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(2),
+         "the number of threads accessing the deque (one owner, the "
+         "remaining ones are stealing)")
+        ("items,i", value<std::uint64_t>(&items)->default_value(500000),
+         "the number of items to push onto the deque")
+    ;
+    // clang-format on
+
+    store(command_line_parser(argc, argv)
+              .options(desc_cmdline)
+              .allow_unregistered()
+              .run(),
+        vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return hpx::util::report_errors();
+    }
+
+    test_single_threaded();
+    test_concurrent_steal();
+
+    return hpx::util::report_errors();
+}
@@ -172,6 +172,20 @@
 #  define HPX_AGAS_LOCAL_CACHE_SIZE 4096
 #endif
 
+/// This defines the number of independently locked shards the local AGAS
+/// address translation cache is split into. The value is rounded up to the
+/// next power of two.
+///
+/// This value can be changes at runtime by setting the configuration parameter:
+///
+///   hpx.agas.local_cache_shards = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_AGAS_LOCAL_CACHE_SHARDS)
+#if !defined(HPX_AGAS_LOCAL_CACHE_SHARDS)
+#  define HPX_AGAS_LOCAL_CACHE_SHARDS 16
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
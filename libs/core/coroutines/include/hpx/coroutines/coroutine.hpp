@@ -158,6 +158,13 @@ namespace hpx { namespace threads { namespace coroutines {
 #endif
         }
 
+        // Return the stack space used by the last run of this coroutine
+        // (if hpx.stacks.auto_size is enabled, otherwise zero)
+        std::ptrdiff_t get_stack_high_water_mark() const
+        {
+            return impl_.get_stack_high_water_mark();
+        }
+
         impl_type* impl()
         {
             return &impl_;
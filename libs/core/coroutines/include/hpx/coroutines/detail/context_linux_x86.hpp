@@ -201,6 +201,7 @@ namespace hpx { namespace threads { namespace coroutines {
                         static_cast<std::ptrdiff_t>(default_stack_size) :
                         stack_size)
               , m_stack(nullptr)
+              , m_stack_high_water_mark(0)
             {
             }
 
@@ -348,6 +349,15 @@ namespace hpx { namespace threads { namespace coroutines {
                         void reset_stack()
                         {
                             HPX_ASSERT(m_stack);
+                            if (posix::track_stack_high_water_mark)
+                            {
+                                m_stack_high_water_mark =
+                                    static_cast<std::ptrdiff_t>(
+                                        posix::get_stack_high_water_mark(
+                                            m_stack,
+                                            static_cast<std::size_t>(
+                                                m_stack_size)));
+                            }
                             if (posix::reset_stack(m_stack,
                                     static_cast<std::size_t>(m_stack_size)))
                             {
@@ -388,6 +398,13 @@ namespace hpx { namespace threads { namespace coroutines {
                                 context_size;
                         }
 
+                        // Return the stack space used by the last run of
+                        // this context (measured on reset_stack, if enabled)
+                        std::ptrdiff_t get_stack_high_water_mark() const
+                        {
+                            return m_stack_high_water_mark;
+                        }
+
                         typedef std::atomic<std::int64_t> counter_type;
 
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
@@ -509,6 +526,7 @@ namespace hpx { namespace threads { namespace coroutines {
 
                         std::ptrdiff_t m_stack_size;
                         void* m_stack;
+                        std::ptrdiff_t m_stack_high_water_mark;
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
     !defined(HPX_HAVE_ADDRESS_SANITIZER)
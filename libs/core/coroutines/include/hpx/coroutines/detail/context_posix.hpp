@@ -345,6 +345,12 @@ namespace hpx { namespace threads { namespace coroutines {
 #endif
             }
 
+            // measuring the stack high-water mark is not supported
+            std::ptrdiff_t get_stack_high_water_mark() const
+            {
+                return 0;
+            }
+
             void reset_stack()
             {
                 if (m_stack)
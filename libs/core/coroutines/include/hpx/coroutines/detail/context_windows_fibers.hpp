@@ -258,6 +258,12 @@ namespace hpx { namespace threads { namespace coroutines {
                     (std::ptrdiff_t) mbi.AllocationBase;
             }
 
+            // measuring the stack high-water mark is not supported
+            std::ptrdiff_t get_stack_high_water_mark() const
+            {
+                return 0;
+            }
+
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
             typedef std::atomic<std::int64_t> counter_type;
 
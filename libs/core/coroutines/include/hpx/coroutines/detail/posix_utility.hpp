@@ -46,6 +46,7 @@
  */
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -74,11 +75,44 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         HPX_CORE_EXPORT extern bool use_guard_pages;
 
+        // Maximal number of stacks (per stack size and NUMA domain) kept in
+        // the process-wide stack cache (hpx.stacks.pool_size), a value of
+        // zero disables the cache.
+        HPX_CORE_EXPORT extern std::size_t stack_pool_size;
+
+        // Number of cached stacks (per stack size and NUMA domain) which keep
+        // their memory resident (hpx.stacks.pool_low_watermark), the memory of
+        // all stacks in excess of this is released when they are cached.
+        HPX_CORE_EXPORT extern std::size_t stack_pool_low_watermark;
+
+        // Whether the high-water mark of the stacks is measured whenever a
+        // stack is reset (see hpx.stacks.auto_size).
+        HPX_CORE_EXPORT extern bool track_stack_high_water_mark;
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
+        // Take a stack of the given size from the process-wide stack cache,
+        // returns nullptr if none is available.
+        HPX_CORE_EXPORT void* stack_pool_alloc(std::size_t size);
+
+        // Return a stack to the process-wide stack cache, returns false if
+        // the cache is full (in which case the stack has to be unmapped).
+        HPX_CORE_EXPORT bool stack_pool_free(void* stack, std::size_t size);
+
+        // Number of stack allocations served from (or missing) the cache.
+        HPX_CORE_EXPORT std::int64_t get_stack_pool_hit_count(bool reset);
+        HPX_CORE_EXPORT std::int64_t get_stack_pool_miss_count(bool reset);
+
         inline void* alloc_stack(std::size_t size)
         {
+            if (stack_pool_size != 0)
+            {
+                void* stack = stack_pool_alloc(size);
+                if (stack != nullptr)
+                    return stack;
+            }
+
             void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
                 PROT_EXEC | PROT_READ | PROT_WRITE,
 #if defined(__APPLE__)
@@ -151,8 +185,17 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             return false;
         }
 
+        // Return the number of bytes (from the top of the stack) which have
+        // been touched since the stack was last reset. This relies on the
+        // pages below the first page being released by reset_stack.
+        HPX_CORE_EXPORT std::size_t get_stack_high_water_mark(
+            void* stack, std::size_t size);
+
         inline void free_stack(void* stack, std::size_t size)
         {
+            if (stack_pool_size != 0 && stack_pool_free(stack, size))
+                return;
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
             {
@@ -198,6 +241,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         inline void watermark_stack(void* stack, std::size_t size) {
         }    // no-op
 
+        inline std::size_t get_stack_high_water_mark(
+            void* stack, std::size_t size)
+        {
+            return 0;    // not supported
+        }
+
         inline bool reset_stack(void* stack, std::size_t size)
         {
             return false;
@@ -10,11 +10,190 @@
     defined(__FreeBSD__) || defined(__APPLE__)
 #include <hpx/coroutines/detail/posix_utility.hpp>
 
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <boost/lockfree/policies.hpp>
+#include <boost/lockfree/stack.hpp>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#endif
+
 namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         ///////////////////////////////////////////////////////////////////////
         // this global (urghhh) variable is used to control whether guard pages
         // will be used or not
         HPX_CORE_EXPORT bool use_guard_pages = true;
+
+        // these global variables control the process-wide stack cache
+        HPX_CORE_EXPORT std::size_t stack_pool_size = 0;
+        HPX_CORE_EXPORT std::size_t stack_pool_low_watermark = 0;
+
+        // this global variable controls whether stack high-water marks are
+        // measured
+        HPX_CORE_EXPORT bool track_stack_high_water_mark = false;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+        namespace {
+            ///////////////////////////////////////////////////////////////////
+            // The stack cache keeps one bucket of stacks per NUMA domain and
+            // per stack size. Stacks are shared by all thread pools.
+            constexpr std::size_t max_numa_domains = 8;
+            constexpr std::size_t max_stack_sizes = 8;
+
+            struct stack_bucket
+            {
+                stack_bucket()
+                  : size_(0)
+                  , count_(0)
+                  , stacks_(64)
+                {
+                }
+
+                std::atomic<std::size_t> size_;
+                std::atomic<std::size_t> count_;
+                boost::lockfree::stack<void*,
+                    boost::lockfree::fixed_sized<false>>
+                    stacks_;
+            };
+
+            struct stack_pool
+            {
+                stack_bucket* get_bucket(std::size_t size, bool create)
+                {
+                    std::size_t const domain = get_numa_domain();
+                    for (stack_bucket& b : buckets_[domain])
+                    {
+                        std::size_t bucket_size =
+                            b.size_.load(std::memory_order_acquire);
+
+                        // claim an unused bucket for this stack size
+                        if (bucket_size == 0 && create &&
+                            b.size_.compare_exchange_strong(bucket_size, size))
+                        {
+                            return &b;
+                        }
+
+                        if (bucket_size == size)
+                            return &b;
+                    }
+                    return nullptr;
+                }
+
+                static std::size_t get_numa_domain()
+                {
+#if defined(__linux__) && defined(__GLIBC__) &&                                \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+                    unsigned int cpu = 0;
+                    unsigned int node = 0;
+                    if (::getcpu(&cpu, &node) == 0)
+                        return node % max_numa_domains;
+#endif
+                    return 0;
+                }
+
+                stack_bucket buckets_[max_numa_domains][max_stack_sizes];
+
+                std::atomic<std::int64_t> hits_{0};
+                std::atomic<std::int64_t> misses_{0};
+            };
+
+            stack_pool& get_stack_pool()
+            {
+                // the pool is intentionally leaked as stacks may be released
+                // during static destruction
+                static stack_pool* pool = new stack_pool;
+                return *pool;
+            }
+        }    // namespace
+
+        void* stack_pool_alloc(std::size_t size)
+        {
+            stack_pool& pool = get_stack_pool();
+
+            stack_bucket* bucket = pool.get_bucket(size, false);
+            void* stack = nullptr;
+            if (bucket != nullptr && bucket->stacks_.pop(stack))
+            {
+                --bucket->count_;
+                ++pool.hits_;
+                return stack;
+            }
+
+            ++pool.misses_;
+            return nullptr;
+        }
+
+        bool stack_pool_free(void* stack, std::size_t size)
+        {
+            stack_bucket* bucket = get_stack_pool().get_bucket(size, true);
+            if (bucket == nullptr)
+                return false;
+
+            std::size_t const count = ++bucket->count_;
+            if (count > stack_pool_size)
+            {
+                // the cache is full, the caller unmaps the stack
+                --bucket->count_;
+                return false;
+            }
+
+            // Only stacks in excess of the low watermark give back their
+            // (possibly dirty) pages, all others are kept resident for fast
+            // reuse. The top page is kept as it holds the watermark.
+            if (count > stack_pool_low_watermark)
+            {
+                ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+            }
+
+            bucket->stacks_.push(stack);
+            return true;
+        }
+
+        std::size_t get_stack_high_water_mark(void* stack, std::size_t size)
+        {
+            // All pages of the stack which have been touched are resident,
+            // find the lowest one (the stack grows downwards).
+            std::size_t const pages = size / EXEC_PAGESIZE;
+
+            static thread_local std::vector<unsigned char> residency;
+            residency.resize(pages);
+
+#if defined(__APPLE__) || defined(__FreeBSD__)
+            char* vec = reinterpret_cast<char*>(residency.data());
+#else
+            unsigned char* vec = residency.data();
+#endif
+            if (::mincore(stack, size, vec) != 0)
+                return 0;
+
+            for (std::size_t i = 0; i != pages; ++i)
+            {
+                if (residency[i] & 1)
+                    return size - i * EXEC_PAGESIZE;
+            }
+            return 0;
+        }
+
+        std::int64_t get_stack_pool_hit_count(bool reset)
+        {
+            return util::get_and_reset_value(get_stack_pool().hits_, reset);
+        }
+
+        std::int64_t get_stack_pool_miss_count(bool reset)
+        {
+            return util::get_and_reset_value(get_stack_pool().misses_, reset);
+        }
+#endif
 }}}}}    // namespace hpx::threads::coroutines::detail::posix
 #endif
@@ -19,6 +19,7 @@
 #include <iosfwd>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -43,6 +44,8 @@ namespace hpx { namespace threads { namespace detail {
 
         void create_work(thread_init_data& data, error_code& ec);
 
+        void create_work(std::vector<thread_init_data>& data, error_code& ec);
+
         thread_state set_state(thread_id_type const& id,
             thread_state_enum new_state, thread_state_ex_enum new_state_ex,
             thread_priority priority, error_code& ec);
@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <exception>
+#include <vector>
 
 namespace hpx { namespace threads { namespace detail {
     io_service_thread_pool::io_service_thread_pool(
@@ -50,6 +51,11 @@ namespace hpx { namespace threads { namespace detail {
     {
     }
 
+    void io_service_thread_pool::create_work(
+        std::vector<thread_init_data>& data, error_code& ec)
+    {
+    }
+
     threads::thread_state io_service_thread_pool::set_state(
         thread_id_type const& id, thread_state_enum new_state,
         thread_state_ex_enum new_state_ex, thread_priority priority,
@@ -316,6 +316,51 @@ namespace hpx { namespace threads { namespace policies {
             queues_[num_thread]->create_thread(data, id, ec);
         }
 
+        // create a batch of threads, all of them are placed onto the queue
+        // selected by the schedule hint of the first one
+        void create_threads(
+            std::vector<thread_init_data>& data, error_code& ec) override
+        {
+            if (data.empty())
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
+            for (thread_init_data const& d : data)
+            {
+                if (d.run_now)
+                {
+                    scheduler_base::create_threads(data, ec);
+                    return;
+                }
+            }
+
+            thread_schedule_hint const& hint = data.front().schedulehint;
+            std::size_t num_thread =
+                hint.mode == thread_schedule_hint_mode_thread ?
+                hint.hint :
+                std::size_t(-1);
+
+            std::size_t queue_size = queues_.size();
+
+            if (std::size_t(-1) == num_thread)
+            {
+                num_thread = curr_queue_++ % queue_size;
+            }
+            else if (num_thread >= queue_size)
+            {
+                num_thread %= queue_size;
+            }
+
+            std::unique_lock<pu_mutex_type> l;
+            num_thread = select_active_pu(l, num_thread);
+
+            HPX_ASSERT(num_thread < queue_size);
+            queues_[num_thread]->create_threads(data, ec);
+        }
+
         /// Return the next thread to be executed, return false if none is
         /// available
         virtual bool get_next_thread(std::size_t num_thread, bool running,
@@ -19,9 +19,12 @@
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
 #include <hpx/concurrency/concurrentqueue.hpp>
+#include <hpx/concurrency/work_stealing_deque.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <utility>
 
 namespace hpx { namespace threads { namespace policies {
@@ -138,6 +141,89 @@ namespace hpx { namespace threads { namespace policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Chase-Lev work-stealing deque, LIFO for the owning thread + stealing at
+    // the opposite end.
+    //
+    // The owner is the first thread popping from the queue without stealing.
+    // Only this thread pushes to (and pops from) the bottom of the deque, all
+    // items pushed by other threads are collected in a separate FIFO queue.
+    template <typename T>
+    struct work_stealing_lifo_backend
+    {
+        using container_type = hpx::concurrency::work_stealing_deque<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using size_type = std::uint64_t;
+
+        work_stealing_lifo_backend(
+            size_type initial_size = 0, size_type num_thread = size_type(-1))
+          : deque_(std::size_t(initial_size))
+          , inbox_(initial_size, num_thread)
+          , owner_(std::thread::id())
+          , owner_pops_(0)
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            if (!other_end &&
+                owner_.load(std::memory_order_relaxed) ==
+                    std::this_thread::get_id())
+            {
+                deque_.push(val);
+                return true;
+            }
+            return inbox_.push(val);
+        }
+
+        bool pop(reference val, bool steal = true)
+        {
+            if (!steal && is_owner())
+            {
+                // prefer the most recently pushed items, but regularly look
+                // at the items handed over by other threads as well
+                if ((++owner_pops_ & 0x3f) != 0 && deque_.pop(val))
+                    return true;
+                return inbox_.pop(val) || deque_.pop(val);
+            }
+            return deque_.steal(val) || inbox_.pop(val);
+        }
+
+        bool empty()
+        {
+            return deque_.empty() && inbox_.empty();
+        }
+
+    private:
+        bool is_owner()
+        {
+            std::thread::id const id = std::this_thread::get_id();
+            std::thread::id owner = owner_.load(std::memory_order_relaxed);
+            if (owner == id)
+                return true;
+
+            return owner == std::thread::id() &&
+                owner_.compare_exchange_strong(owner, id);
+        }
+
+        container_type deque_;
+        lockfree_fifo_backend<T> inbox_;
+        std::atomic<std::thread::id> owner_;
+        std::uint64_t owner_pops_;
+    };
+
+    struct work_stealing_lifo
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = work_stealing_lifo_backend<T>;
+        };
+    };
+
 // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
             struct lockfree_lifo;
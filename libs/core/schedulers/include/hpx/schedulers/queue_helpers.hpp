@@ -28,6 +28,20 @@ namespace hpx { namespace threads { namespace policies {
 
     ///////////////////////////////////////////////////////////////////////////////
     namespace detail {
+        ///////////////////////////////////////////////////////////////////////////
+        // thread maps either hold thread ids or (intrusively) the thread data
+        inline threads::thread_data const* get_thread_map_entry_data(
+            thread_id_type const& tid)
+        {
+            return get_thread_id_data(tid);
+        }
+
+        inline threads::thread_data const* get_thread_map_entry_data(
+            threads::thread_data const& thrd)
+        {
+            return &thrd;
+        }
+
         ///////////////////////////////////////////////////////////////////////////
         // debug helper function, logs all suspended threads
         // this returns true if all threads in the map are currently suspended
@@ -59,7 +73,8 @@ namespace hpx { namespace threads { namespace policies {
             typename Map::const_iterator end = tm.end();
             for (typename Map::const_iterator it = tm.begin(); it != end; ++it)
             {
-                threads::thread_data const* thrd = get_thread_id_data(*it);
+                threads::thread_data const* thrd =
+                    get_thread_map_entry_data(*it);
                 threads::thread_state_enum state = thrd->get_state().state();
                 threads::thread_state_enum marked_state =
                     thrd->get_marked_state();
@@ -91,8 +106,9 @@ namespace hpx { namespace threads { namespace policies {
                         LTM_(error)
                             << "queue(" << num_thread << "): "    //-V128
                             << get_thread_state_name(state) << "(" << std::hex
-                            << std::setw(8) << std::setfill('0') << (*it) << "."
-                            << std::hex << std::setw(2) << std::setfill('0')
+                            << std::setw(8) << std::setfill('0')
+                            << thrd->get_thread_id() << "." << std::hex
+                            << std::setw(2) << std::setfill('0')
                             << thrd->get_thread_phase() << "/" << std::hex
                             << std::setw(8) << std::setfill('0')
                             << thrd->get_component_id() << ")"
@@ -110,8 +126,9 @@ namespace hpx { namespace threads { namespace policies {
                             << "queue(" << num_thread
                             << "): " << get_thread_state_name(state) << "("
                             << std::hex << std::setw(8) << std::setfill('0')
-                            << (*it) << "." << std::hex << std::setw(2)
-                            << std::setfill('0') << thrd->get_thread_phase()
+                            << thrd->get_thread_id() << "." << std::hex
+                            << std::setw(2) << std::setfill('0')
+                            << thrd->get_thread_phase()
                             << "/" << std::hex << std::setw(8)
                             << std::setfill('0') << thrd->get_component_id()
                             << ")"
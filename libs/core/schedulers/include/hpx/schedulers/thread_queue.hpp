@@ -32,17 +32,19 @@
 #include <hpx/timing/tick_counter.hpp>
 #endif
 
+#include <boost/intrusive/list.hpp>
+#include <boost/lockfree/policies.hpp>
+#include <boost/lockfree/stack.hpp>
+
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
-#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -88,13 +90,21 @@ namespace hpx { namespace threads { namespace policies {
         // we use a simple mutex to protect the data members for now
         using mutex_type = Mutex;
 
-        // this is the type of a map holding all threads (except depleted ones)
-        using thread_map_type = std::unordered_set<thread_id_type,
-            std::hash<thread_id_type>, std::equal_to<thread_id_type>,
-            util::internal_allocator<thread_id_type>>;
-
-        using thread_heap_type =
-            std::list<thread_id_type, util::internal_allocator<thread_id_type>>;
+        // this is the type of a map holding all threads (except depleted ones),
+        // the threads are linked through a hook embedded in thread_data, thus
+        // inserting and erasing never allocates
+        using thread_map_type = boost::intrusive::list<thread_data,
+            boost::intrusive::member_hook<thread_data,
+                thread_data::queue_hook_type, &thread_data::queue_hook_>,
+            boost::intrusive::constant_time_size<false>>;
+
+        // The recycled thread objects are kept in lock-free LIFO free-lists
+        // (one per stack size). The nodes of these lists are themselves
+        // recycled through the caching freelist of the underlying stack, so
+        // that neither creating nor recycling a thread needs to acquire mtx_.
+        using thread_heap_type = boost::lockfree::stack<thread_data*,
+            boost::lockfree::fixed_sized<false>,
+            boost::lockfree::allocator<util::internal_allocator<thread_data*>>>;
 
         struct task_description
         {
@@ -124,37 +134,53 @@ namespace hpx { namespace threads { namespace policies {
             typename TerminatedQueuing::template apply<thread_data*>::type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_type& thrd,
-            threads::thread_init_data& data, Lock& lk)
+        thread_heap_type* get_thread_heap(std::ptrdiff_t stacksize)
         {
-            HPX_ASSERT(lk.owns_lock());
-
-            std::ptrdiff_t const stacksize =
-                data.scheduler_base->get_stack_size(data.stacksize);
-
-            thread_heap_type* heap = nullptr;
-
             if (stacksize == parameters_.small_stacksize_)
             {
-                heap = &thread_heap_small_;
+                return &thread_heap_small_;
             }
             else if (stacksize == parameters_.medium_stacksize_)
             {
-                heap = &thread_heap_medium_;
+                return &thread_heap_medium_;
             }
             else if (stacksize == parameters_.large_stacksize_)
             {
-                heap = &thread_heap_large_;
+                return &thread_heap_large_;
             }
             else if (stacksize == parameters_.huge_stacksize_)
             {
-                heap = &thread_heap_huge_;
+                return &thread_heap_huge_;
             }
             else if (stacksize == parameters_.nostack_stacksize_)
             {
-                heap = &thread_heap_nostack_;
+                return &thread_heap_nostack_;
+            }
+            return nullptr;
+        }
+
+        threads::thread_data* allocate_thread_object(
+            threads::thread_init_data& data, std::ptrdiff_t stacksize)
+        {
+            if (stacksize == parameters_.nostack_stacksize_)
+            {
+                return threads::thread_data_stackless::create(
+                    data, this, stacksize);
             }
+            return threads::thread_data_stackful::create(data, this, stacksize);
+        }
+
+        // Take a thread object from the free-lists (which do not require
+        // holding mtx_) or allocate a new one, releasing the lock while doing
+        // so.
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, Lock& lk)
+        {
+            std::ptrdiff_t const stacksize =
+                data.scheduler_base->get_stack_size(data.stacksize);
+
+            thread_heap_type* heap = get_thread_heap(stacksize);
             HPX_ASSERT(heap);
 
             if (data.initial_state == pending_do_not_schedule ||
@@ -164,31 +190,24 @@ namespace hpx { namespace threads { namespace policies {
             }
 
             // Check for an unused thread object.
-            if (!heap->empty())
+            threads::thread_data* p = nullptr;
+            if (heap->pop(p))
             {
                 // Take ownership of the thread object and rebind it.
-                thrd = heap->front();
-                heap->pop_front();
-                get_thread_id_data(thrd)->rebind(data);
+                p->rebind(data);
             }
-            else
+            else if (lk.owns_lock())
             {
                 hpx::util::unlock_guard<Lock> ull(lk);
 
                 // Allocate a new thread object.
-                threads::thread_data* p = nullptr;
-                if (stacksize == parameters_.nostack_stacksize_)
-                {
-                    p = threads::thread_data_stackless::create(
-                        data, this, stacksize);
-                }
-                else
-                {
-                    p = threads::thread_data_stackful::create(
-                        data, this, stacksize);
-                }
-                thrd = thread_id_type(p);
+                p = allocate_thread_object(data, stacksize);
+            }
+            else
+            {
+                p = allocate_thread_object(data, stacksize);
             }
+            thrd = thread_id_type(p);
         }
 
         static util::internal_allocator<task_description>
@@ -229,20 +248,7 @@ namespace hpx { namespace threads { namespace policies {
                 task_description_alloc_.deallocate(task, 1);
 
                 // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> p =
-                    thread_map_.insert(thrd);
-
-                if (HPX_UNLIKELY(!p.second))
-                {
-                    --addfrom->new_tasks_count_.data_;
-                    lk.unlock();
-                    HPX_THROW_EXCEPTION(hpx::out_of_memory,
-                        "thread_queue::add_new",
-                        "Couldn't add new thread to the thread map");
-                    return 0;
-                }
-
-                ++thread_map_count_;
+                add_to_thread_map(get_thread_id_data(thrd));
 
                 // Decrement only after thread_map_count_ has been incremented
                 --addfrom->new_tasks_count_.data_;
@@ -258,7 +264,8 @@ namespace hpx { namespace threads { namespace policies {
                 }
 
                 // this thread has to be in the map now
-                HPX_ASSERT(thread_map_.find(thrd) != thread_map_.end());
+                HPX_ASSERT(
+                    get_thread_id_data(thrd)->queue_hook_.is_linked());
                 HPX_ASSERT(
                     &get_thread_id_data(thrd)->get_queue<thread_queue>() ==
                     this);
@@ -289,8 +296,7 @@ namespace hpx { namespace threads { namespace policies {
             // map holds more than max_thread_count
             if (HPX_LIKELY(parameters_.max_thread_count_))
             {
-                std::int64_t count =
-                    static_cast<std::int64_t>(thread_map_.size());
+                std::int64_t count = thread_map_count_;
                 if (parameters_.max_thread_count_ >=
                     count + parameters_.min_add_new_count_)
                 {    //-V104
@@ -323,35 +329,35 @@ namespace hpx { namespace threads { namespace policies {
             return addednew != 0;
         }
 
+        void add_to_thread_map(threads::thread_data* thrd)
+        {
+            HPX_ASSERT(!thrd->queue_hook_.is_linked());
+            thread_map_.push_back(*thrd);
+            ++thread_map_count_;
+        }
+
+        void remove_from_thread_map(threads::thread_data* thrd)
+        {
+            // this thread has to be in this map
+            HPX_ASSERT(thrd->queue_hook_.is_linked());
+            thread_map_.erase(thread_map_.iterator_to(*thrd));
+            --thread_map_count_;
+            HPX_ASSERT(thread_map_count_ >= 0);
+        }
+
         void recycle_thread(thread_id_type thrd)
         {
-            std::ptrdiff_t stacksize =
-                get_thread_id_data(thrd)->get_stack_size();
+            threads::thread_data* p = get_thread_id_data(thrd);
 
-            if (stacksize == parameters_.small_stacksize_)
-            {
-                thread_heap_small_.push_front(thrd);
-            }
-            else if (stacksize == parameters_.medium_stacksize_)
-            {
-                thread_heap_medium_.push_front(thrd);
-            }
-            else if (stacksize == parameters_.large_stacksize_)
-            {
-                thread_heap_large_.push_front(thrd);
-            }
-            else if (stacksize == parameters_.huge_stacksize_)
-            {
-                thread_heap_huge_.push_front(thrd);
-            }
-            else if (stacksize == parameters_.nostack_stacksize_)
+            thread_heap_type* heap = get_thread_heap(p->get_stack_size());
+            if (heap != nullptr)
             {
-                thread_heap_nostack_.push_front(thrd);
+                heap->push(p);
             }
             else
             {
-                HPX_ASSERT_MSG(
-                    false, util::format("Invalid stack size {1}", stacksize));
+                HPX_ASSERT_MSG(false,
+                    util::format("Invalid stack size {1}", p->get_stack_size()));
             }
         }
 
@@ -376,20 +382,10 @@ namespace hpx { namespace threads { namespace policies {
                 thread_data* todelete;
                 while (terminated_items_.pop(todelete))
                 {
-                    thread_id_type tid(todelete);
                     --terminated_items_count_;
 
-                    // this thread has to be in this map
-                    HPX_ASSERT(thread_map_.find(tid) != thread_map_.end());
-
-                    bool deleted = thread_map_.erase(tid) != 0;
-                    HPX_ASSERT(deleted);
-                    if (deleted)
-                    {
-                        deallocate(todelete);
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
+                    remove_from_thread_map(todelete);
+                    deallocate(todelete);
                 }
             }
             else
@@ -406,20 +402,10 @@ namespace hpx { namespace threads { namespace policies {
                 thread_data* todelete;
                 while (delete_count && terminated_items_.pop(todelete))
                 {
-                    thread_id_type tid(todelete);
                     --terminated_items_count_;
 
-                    // this thread has to be in this map
-                    HPX_ASSERT(thread_map_.find(tid) != thread_map_.end());
-
-                    bool deleted = thread_map_.erase(tid) != 0;
-                    HPX_ASSERT(deleted);
-                    HPX_UNUSED(deleted);
-                    --thread_map_count_;
-
-                    HPX_ASSERT(thread_map_count_ >= 0);
-
-                    recycle_thread(tid);
+                    remove_from_thread_map(todelete);
+                    recycle_thread(thread_id_type(todelete));
 
                     --delete_count;
                 }
@@ -467,11 +453,11 @@ namespace hpx { namespace threads { namespace policies {
           , new_tasks_wait_(0)
           , new_tasks_wait_count_(0)
 #endif
-          , thread_heap_small_()
-          , thread_heap_medium_()
-          , thread_heap_large_()
-          , thread_heap_huge_()
-          , thread_heap_nostack_()
+          , thread_heap_small_(128)
+          , thread_heap_medium_(128)
+          , thread_heap_large_(128)
+          , thread_heap_huge_(128)
+          , thread_heap_nostack_(128)
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
@@ -496,20 +482,11 @@ namespace hpx { namespace threads { namespace policies {
 
         ~thread_queue()
         {
-            for (auto t : thread_heap_small_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_medium_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_large_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_huge_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_nostack_)
-                deallocate(get_thread_id_data(t));
+            thread_heap_small_.consume_all(&thread_queue::deallocate);
+            thread_heap_medium_.consume_all(&thread_queue::deallocate);
+            thread_heap_large_.consume_all(&thread_queue::deallocate);
+            thread_heap_huge_.consume_all(&thread_queue::deallocate);
+            thread_heap_nostack_.consume_all(&thread_queue::deallocate);
         }
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
@@ -657,30 +634,23 @@ namespace hpx { namespace threads { namespace policies {
 
                 // The mutex can not be locked while a new thread is getting
                 // created, as it might have that the current HPX thread gets
-                // suspended.
+                // suspended. Creating the thread object does not need the
+                // mutex.
                 {
-                    std::unique_lock<mutex_type> lk(mtx_);
+                    std::unique_lock<mutex_type> lk(mtx_, std::defer_lock);
 
                     bool schedule_now = data.initial_state == pending;
 
                     create_thread_object(thrd, data, lk);
 
-                    // add a new entry in the map for this thread
-                    std::pair<thread_map_type::iterator, bool> p =
-                        thread_map_.insert(thrd);
+                    lk.lock();
 
-                    if (HPX_UNLIKELY(!p.second))
-                    {
-                        lk.unlock();
-                        HPX_THROWS_IF(ec, hpx::out_of_memory,
-                            "thread_queue::create_thread",
-                            "Couldn't add new thread to the map of threads");
-                        return;
-                    }
-                    ++thread_map_count_;
+                    // add a new entry in the map for this thread
+                    add_to_thread_map(get_thread_id_data(thrd));
 
                     // this thread has to be in the map now
-                    HPX_ASSERT(thread_map_.find(thrd) != thread_map_.end());
+                    HPX_ASSERT(
+                        get_thread_id_data(thrd)->queue_hook_.is_linked());
                     HPX_ASSERT(
                         &get_thread_id_data(thrd)->get_queue<thread_queue>() ==
                         this);
@@ -717,6 +687,51 @@ namespace hpx { namespace threads { namespace policies {
                 ec = make_success_code();
         }
 
+        // register a batch of task descriptions for later thread creation,
+        // none of the given threads may have to be run immediately
+        void create_threads(std::vector<thread_init_data>& data, error_code& ec)
+        {
+            if (data.empty())
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
+            // account for all new tasks at once, the counter has to be
+            // incremented before the descriptions become visible
+            new_tasks_count_.data_.fetch_add(
+                static_cast<std::int64_t>(data.size()));
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+#endif
+            thread_stacksize const self_stacksize = get_self_stacksize_enum();
+
+            for (thread_init_data& d : data)
+            {
+                HPX_ASSERT(!d.run_now);
+
+                if (d.stacksize == threads::thread_stacksize_current)
+                {
+                    d.stacksize = self_stacksize;
+                }
+
+                HPX_ASSERT(d.stacksize != threads::thread_stacksize_current);
+
+                task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                new (td) task_description{std::move(d), now};
+#else
+                new (td) task_description{std::move(d)};    //-V106
+#endif
+                new_tasks_.push(td);
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description* trd;
@@ -866,11 +881,9 @@ namespace hpx { namespace threads { namespace policies {
             std::lock_guard<mutex_type> lk(mtx_);
 
             std::int64_t num_threads = 0;
-            thread_map_type::const_iterator end = thread_map_.end();
-            for (thread_map_type::const_iterator it = thread_map_.begin();
-                 it != end; ++it)
+            for (thread_data const& thrd : thread_map_)
             {
-                if (get_thread_id_data(*it)->get_state().state() == state)
+                if (thrd.get_state().state() == state)
                     ++num_threads;
             }
             return num_threads;
@@ -880,15 +893,12 @@ namespace hpx { namespace threads { namespace policies {
         void abort_all_suspended_threads()
         {
             std::lock_guard<mutex_type> lk(mtx_);
-            thread_map_type::iterator end = thread_map_.end();
-            for (thread_map_type::iterator it = thread_map_.begin(); it != end;
-                 ++it)
+            for (thread_data& thrd : thread_map_)
             {
-                auto thrd = get_thread_id_data(*it);
-                if (thrd->get_state().state() == suspended)
+                if (thrd.get_state().state() == suspended)
                 {
-                    thrd->set_state(pending, wait_abort);
-                    schedule_thread(thrd);
+                    thrd.set_state(pending, wait_abort);
+                    schedule_thread(&thrd);
                 }
             }
         }
@@ -916,22 +926,18 @@ namespace hpx { namespace threads { namespace policies {
             if (state == unknown)
             {
                 std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end = thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
+                for (thread_data const& thrd : thread_map_)
                 {
-                    ids.push_back(*it);
+                    ids.push_back(thrd.get_thread_id());
                 }
             }
             else
             {
                 std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end = thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
+                for (thread_data const& thrd : thread_map_)
                 {
-                    if (get_thread_id_data(*it)->get_state().state() == state)
-                        ids.push_back(*it);
+                    if (thrd.get_state().state() == state)
+                        ids.push_back(thrd.get_thread_id());
                 }
             }
 
@@ -0,0 +1,284 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_WORK_STEALING_SCHEDULER)
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/schedulers/thread_queue.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    using default_work_stealing_scheduler_terminated_queue = lockfree_lifo;
+#else
+    using default_work_stealing_scheduler_terminated_queue = lockfree_fifo;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The work_stealing_scheduler maintains one Chase-Lev work-stealing
+    /// deque per OS thread. The OS thread executes the work it has created
+    /// itself in LIFO order, idle OS threads steal half of the work of a
+    /// randomly selected victim in FIFO order, preferring victims from the
+    /// same NUMA domain.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = work_stealing_lifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_work_stealing_scheduler_terminated_queue>
+    class work_stealing_scheduler
+      : public local_queue_scheduler<Mutex, PendingQueuing, StagedQueuing,
+            TerminatedQueuing>
+    {
+    public:
+        typedef local_queue_scheduler<Mutex, PendingQueuing, StagedQueuing,
+            TerminatedQueuing>
+            base_type;
+
+        typedef typename base_type::thread_queue_type thread_queue_type;
+
+        work_stealing_scheduler(
+            typename base_type::init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , victims_(init.num_queues_)
+        {
+            for (std::size_t i = 0; i != victims_.size(); ++i)
+            {
+                victims_[i].random_state_ =
+                    (i + 1) * std::uint64_t(0x9e3779b97f4a7c15ull);
+            }
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "work_stealing_scheduler";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(
+            thread_init_data& data, thread_id_type* id, error_code& ec) override
+        {
+            // keep new work local to the creating OS thread, other OS threads
+            // will steal it if needed
+            if (data.schedulehint.mode == thread_schedule_hint_mode_none)
+            {
+                std::size_t num_thread = get_current_queue_index();
+                if (num_thread != std::size_t(-1))
+                {
+                    data.schedulehint = thread_schedule_hint(
+                        static_cast<std::int16_t>(num_thread));
+                }
+            }
+            base_type::create_thread(data, id, ec);
+        }
+
+        void create_threads(
+            std::vector<thread_init_data>& data, error_code& ec) override
+        {
+            if (!data.empty() &&
+                data.front().schedulehint.mode ==
+                    thread_schedule_hint_mode_none)
+            {
+                std::size_t num_thread = get_current_queue_index();
+                if (num_thread != std::size_t(-1))
+                {
+                    data.front().schedulehint = thread_schedule_hint(
+                        static_cast<std::int16_t>(num_thread));
+                }
+            }
+            base_type::create_threads(data, ec);
+        }
+
+        /// Schedule the passed thread
+        void schedule_thread(threads::thread_data* thrd,
+            threads::thread_schedule_hint schedulehint, bool allow_fallback,
+            thread_priority priority = thread_priority_normal) override
+        {
+            // threads made runnable by a thread running on this scheduler
+            // are pushed onto the deque of the current OS thread
+            if (schedulehint.mode == thread_schedule_hint_mode_none)
+            {
+                std::size_t num_thread = get_current_queue_index();
+                if (num_thread != std::size_t(-1))
+                {
+                    schedulehint = thread_schedule_hint(
+                        static_cast<std::int16_t>(num_thread));
+                    allow_fallback = true;
+                }
+            }
+            base_type::schedule_thread(
+                thrd, schedulehint, allow_fallback, priority);
+        }
+
+        /// Return the next thread to be executed, return false if none is
+        /// available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_data*& thrd, bool /*enable_stealing*/) override
+        {
+            HPX_ASSERT(num_thread < this->queues_.size());
+
+            {
+                thread_queue_type* q = this->queues_[num_thread];
+                bool result = q->get_next_thread(thrd);
+
+                q->increment_num_pending_accesses();
+                if (result)
+                    return true;
+                q->increment_num_pending_misses();
+
+                bool have_staged =
+                    q->get_staged_queue_length(std::memory_order_relaxed) != 0;
+
+                // Give up, we should have work to convert.
+                if (have_staged)
+                    return false;
+            }
+
+            if (!running)
+            {
+                return false;
+            }
+
+            // try the victims in the same NUMA domain first
+            victim_data& v = victims_[num_thread];
+            if (steal_from(num_thread, v.near_, v.random_state_, thrd))
+                return true;
+
+            if (this->has_scheduler_mode(policies::enable_stealing_numa))
+            {
+                return steal_from(num_thread, v.far_, v.random_state_, thrd);
+            }
+            return false;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void on_start_thread(std::size_t num_thread) override
+        {
+            base_type::on_start_thread(num_thread);
+
+            // sort all other queues by whether they belong to the NUMA domain
+            // of this OS thread
+            victim_data& v = victims_[num_thread];
+            v.near_.clear();
+            v.far_.clear();
+
+            mask_cref_type numa_domain = this->numa_domain_masks_[num_thread];
+            for (std::size_t i = 0; i != this->queues_.size(); ++i)
+            {
+                if (i == num_thread)
+                    continue;
+
+                if (test(numa_domain, this->affinity_data_.get_pu_num(i)))
+                    v.near_.push_back(i);
+                else
+                    v.far_.push_back(i);
+            }
+        }
+
+    protected:
+        // Return the index of the queue owned by the calling OS thread, or -1
+        // if the calling thread does not run on this scheduler.
+        std::size_t get_current_queue_index() const
+        {
+            threads::thread_data* self = threads::get_self_id_data();
+            if (self == nullptr || self->get_scheduler_base() != this)
+                return std::size_t(-1);
+
+            std::size_t num_thread = hpx::get_local_worker_thread_num();
+            if (num_thread >= this->queues_.size())
+                return std::size_t(-1);
+            return num_thread;
+        }
+
+        static std::uint64_t next_random(std::uint64_t& state)
+        {
+            // xorshift64*
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * std::uint64_t(0x2545f4914f6cdd1dull);
+        }
+
+        // Visit the given victims starting at a random position, steal half
+        // of the work of the first victim which has some.
+        bool steal_from(std::size_t num_thread,
+            std::vector<std::size_t> const& victims, std::uint64_t& state,
+            threads::thread_data*& thrd)
+        {
+            std::size_t const num_victims = victims.size();
+            if (num_victims == 0)
+                return false;
+
+            std::size_t const first =
+                static_cast<std::size_t>(next_random(state) % num_victims);
+
+            thread_queue_type* q = this->queues_[num_thread];
+            for (std::size_t i = 0; i != num_victims; ++i)
+            {
+                std::size_t idx = first + i;
+                if (idx >= num_victims)
+                    idx -= num_victims;
+
+                thread_queue_type* victim = this->queues_[victims[idx]];
+                if (!victim->get_next_thread(thrd, true, true))
+                    continue;
+
+                victim->increment_num_stolen_from_pending();
+                q->increment_num_stolen_to_pending();
+
+                // move up to half of the remaining work to our own deque
+                std::int64_t count = victim->get_pending_queue_length(
+                                         std::memory_order_relaxed) /
+                    2;
+
+                threads::thread_data* t = nullptr;
+                while (count-- > 0 && victim->get_next_thread(t, true, true))
+                {
+                    q->schedule_thread(t);
+
+                    victim->increment_num_stolen_from_pending();
+                    q->increment_num_stolen_to_pending();
+                }
+                return true;
+            }
+            return false;
+        }
+
+        struct victim_data
+        {
+            std::vector<std::size_t> near_;
+            std::vector<std::size_t> far_;
+            std::uint64_t random_state_;
+        };
+
+        std::vector<util::cache_aligned_data_derived<victim_data>> victims_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -75,6 +75,8 @@ namespace hpx { namespace threads { namespace detail {
             error_code& ec) override;
 
         void create_work(thread_init_data& data, error_code& ec) override;
+        void create_work(
+            std::vector<thread_init_data>& data, error_code& ec) override;
 
         thread_state set_state(thread_id_type const& id,
             thread_state_enum new_state, thread_state_ex_enum new_state_ex,
@@ -10,6 +10,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/stack_size_tracking.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
@@ -87,6 +88,16 @@ namespace hpx { namespace threads { namespace detail {
         if (data.priority == thread_priority_default)
             data.priority = thread_priority_normal;
 
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+        // adapt the stack size to what earlier threads with the same
+        // description have used (see hpx.stacks.auto_size)
+        if (stack_size_tracking_enabled)
+        {
+            data.stacksize = adapt_stacksize(
+                scheduler, data.description, data.stacksize);
+        }
+#endif
+
         // create the new thread
         scheduler->create_thread(data, &id, ec);
 
@@ -10,13 +10,17 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/stack_size_tracking.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
 #include <sstream>
+#include <vector>
 
 namespace hpx { namespace threads { namespace detail {
-    inline void create_work(policies::scheduler_base* scheduler,
+    // verify the given data and fill in the defaults derived from the
+    // scheduler and the calling thread, returns false on error
+    inline bool prepare_work(policies::scheduler_base* scheduler,
         thread_init_data& data, error_code& ec = throws)
     {
         // verify parameters
@@ -35,7 +39,7 @@ namespace hpx { namespace threads { namespace detail {
                  << get_thread_state_name(data.initial_state);
             HPX_THROWS_IF(
                 ec, bad_parameter, "thread::detail::create_work", strm.str());
-            return;
+            return false;
         }
         }
 
@@ -44,7 +48,7 @@ namespace hpx { namespace threads { namespace detail {
         {
             HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
                 "description is nullptr");
-            return;
+            return false;
         }
 #endif
 
@@ -94,10 +98,50 @@ namespace hpx { namespace threads { namespace detail {
             thread_priority_high_recursive == data.priority ||
             thread_priority_boost == data.priority);
 
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+        // adapt the stack size to what earlier threads with the same
+        // description have used (see hpx.stacks.auto_size)
+        if (stack_size_tracking_enabled)
+        {
+            data.stacksize = adapt_stacksize(
+                scheduler, data.description, data.stacksize);
+        }
+#endif
+
+        return true;
+    }
+
+    inline void create_work(policies::scheduler_base* scheduler,
+        thread_init_data& data, error_code& ec = throws)
+    {
+        if (!prepare_work(scheduler, data, ec))
+            return;
+
         scheduler->create_thread(data, nullptr, ec);
 
         // NOTE: Don't care if the hint is a NUMA hint, just want to wake up a
         // thread.
         scheduler->do_some_work(data.schedulehint.hint);
     }
+
+    // Create a batch of work items, the scheduler is handed all of them at
+    // once and is woken up only once.
+    inline void create_work(policies::scheduler_base* scheduler,
+        std::vector<thread_init_data>& data, error_code& ec = throws)
+    {
+        if (data.empty())
+            return;
+
+        for (thread_init_data& d : data)
+        {
+            if (!prepare_work(scheduler, d, ec))
+                return;
+        }
+
+        scheduler->create_threads(data, ec);
+        if (ec)
+            return;
+
+        scheduler->do_some_work(data.front().schedulehint.hint);
+    }
 }}}    // namespace hpx::threads::detail
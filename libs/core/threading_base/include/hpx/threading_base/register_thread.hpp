@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace threads {
     ///////////////////////////////////////////////////////////////////////////
@@ -221,6 +222,57 @@ namespace hpx { namespace threads {
         register_work(data, detail::get_self_or_default_pool(), ec);
     }
 
+    /// \brief Create a batch of new work items using the given data.
+    ///
+    /// \param data       [in] The data to use for creating the threads. All
+    ///                   items are handed to the scheduler at once, which
+    ///                   places them onto the queue selected by the schedule
+    ///                   hint of the first item.
+    /// \param pool       [in] The thread pool to use for launching the work.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    inline void register_work(std::vector<threads::thread_init_data>& data,
+        threads::thread_pool_base* pool, error_code& ec = throws)
+    {
+        HPX_ASSERT(pool);
+        for (threads::thread_init_data& d : data)
+        {
+            d.run_now = false;
+        }
+        pool->create_work(data, ec);
+    }
+
+    /// \brief Create a batch of new work items using the given data on the
+    ///        same thread pool as the calling thread, or on the default
+    ///        thread pool if not on an HPX thread.
+    ///
+    /// \param data       [in] The data to use for creating the threads.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    inline void register_work(std::vector<threads::thread_init_data>& data,
+        error_code& ec = throws)
+    {
+        register_work(data, detail::get_self_or_default_pool(), ec);
+    }
+
 #if defined(HPX_HAVE_REGISTER_THREAD_OVERLOADS_COMPATIBILITY)
     inline threads::thread_id_type register_thread_plain(
         threads::thread_pool_base* pool, threads::thread_init_data& data,
@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/event_count.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
@@ -208,6 +209,12 @@ namespace hpx { namespace threads { namespace policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_type* id, error_code& ec) = 0;
 
+        // Create a batch of threads which are not run immediately. The
+        // default implementation creates them one by one, schedulers may
+        // override this to place all of them with a single queue operation.
+        virtual void create_threads(
+            std::vector<thread_init_data>& data, error_code& ec);
+
         virtual bool get_next_thread(std::size_t num_thread, bool running,
             threads::thread_data*& thrd, bool enable_stealing) = 0;
 
@@ -324,8 +331,17 @@ namespace hpx { namespace threads { namespace policies {
         {
             std::uint32_t wait_count_;
             double max_idle_backoff_time_;
+
+            // adaptive spinning before parking (enable_idle_parking)
+            std::uint32_t spin_count_;
+            std::uint32_t spin_success_rate_;
         };
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+
+        // support for parking idle OS threads
+        concurrency::event_count idle_parking_;
+
+        void park_idle_thread(std::size_t num_thread);
 #endif
 
         // support for suspension of pus
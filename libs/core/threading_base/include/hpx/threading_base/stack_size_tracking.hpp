@@ -0,0 +1,57 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace threads {
+
+    /// Enable or disable the automatic sizing of the stacks of HPX threads
+    /// (see hpx.stacks.auto_size). If enabled, the stack high-water mark of
+    /// every finished HPX thread is recorded per thread description (as set
+    /// through annotated_function or thread_description). New threads with
+    /// the same description are then created with the smallest stack size
+    /// which fits the largest high-water mark seen so far (plus a
+    /// safety margin of 25%), regardless of the requested stack size.
+    ///
+    /// \note Measuring the high-water mark is currently supported only for
+    ///       the Linux x86 coroutine context implementation with mmap'ed
+    ///       stacks. Everywhere else enabling this is a no-op.
+    HPX_CORE_EXPORT void set_stack_size_tracking_enabled(bool enable);
+    HPX_CORE_EXPORT bool get_stack_size_tracking_enabled();
+
+    /// Return the largest stack high-water mark recorded for HPX threads
+    /// with the given description (zero if none was recorded)
+    HPX_CORE_EXPORT std::size_t get_stack_high_water_mark(
+        util::thread_description const& desc);
+
+    /// Return the number of HPX threads which were created with a larger
+    /// (promoted) or smaller (demoted) stack size than requested.
+    HPX_CORE_EXPORT std::int64_t get_stack_size_promotion_count(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_stack_size_demotion_count(bool reset);
+
+    namespace detail {
+        HPX_CORE_EXPORT extern bool stack_size_tracking_enabled;
+
+        /// Record the stack high-water mark of a finished HPX thread
+        HPX_CORE_EXPORT void record_stack_high_water_mark(
+            util::thread_description const& desc,
+            std::ptrdiff_t high_water_mark);
+
+        /// Return the stack size to use for a new HPX thread with the given
+        /// description, based on the recorded high-water marks
+        HPX_CORE_EXPORT thread_stacksize adapt_stacksize(
+            policies::scheduler_base* scheduler,
+            util::thread_description const& desc, thread_stacksize stacksize);
+    }    // namespace detail
+}}       // namespace hpx::threads
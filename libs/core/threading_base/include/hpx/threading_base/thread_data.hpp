@@ -28,6 +28,8 @@
 #include <hpx/threading_base/external_timer.hpp>
 #endif
 
+#include <boost/intrusive/list_hook.hpp>
+
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -635,6 +637,13 @@ namespace hpx { namespace threads {
         void* queue_;
 
     public:
+        // The hook used by the scheduler queues to keep track of all threads
+        // they manage (see thread_queue::thread_map_type). This allows to
+        // insert and erase threads in O(1) without allocating.
+        using queue_hook_type = boost::intrusive::list_member_hook<
+            boost::intrusive::link_mode<boost::intrusive::safe_link>>;
+        queue_hook_type queue_hook_;
+
 #if defined(HPX_HAVE_APEX)
         std::shared_ptr<util::external_timer::task_wrapper> timer_data_;
 #endif
@@ -15,6 +15,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/threading_base/execution_agent.hpp>
+#include <hpx/threading_base/stack_size_tracking.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
@@ -65,7 +66,20 @@ namespace hpx { namespace threads {
 
             hpx::execution_base::this_thread::reset_agent ctx(
                 agent_storage, agent_);
-            return coroutine_(set_state_ex(wait_signaled));
+            coroutine_type::result_type result =
+                coroutine_(set_state_ex(wait_signaled));
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            // the stack has been reset once the thread has terminated, which
+            // measures its high-water mark (see hpx.stacks.auto_size)
+            if (detail::stack_size_tracking_enabled &&
+                result.first == terminated)
+            {
+                detail::record_stack_high_water_mark(
+                    get_description(), coroutine_.get_stack_high_water_mark());
+            }
+#endif
+            return result;
         }
 
 #if defined(HPX_DEBUG)
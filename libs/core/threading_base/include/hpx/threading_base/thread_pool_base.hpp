@@ -235,6 +235,8 @@ namespace hpx { namespace threads {
         virtual void create_thread(
             thread_init_data& data, thread_id_type& id, error_code& ec) = 0;
         virtual void create_work(thread_init_data& data, error_code& ec) = 0;
+        virtual void create_work(
+            std::vector<thread_init_data>& data, error_code& ec) = 0;
 
         virtual thread_state set_state(thread_id_type const& id,
             thread_state_enum new_state, thread_state_ex_enum new_state_ex,
@@ -34,6 +34,16 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads { namespace policies {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    namespace {
+        // The number of times an idle OS thread polls for new work before
+        // being parked adapts between these bounds (see park_idle_thread).
+        constexpr std::uint32_t min_idle_spin_count = 16;
+        constexpr std::uint32_t initial_idle_spin_count = 256;
+        constexpr std::uint32_t max_idle_spin_count = 16384;
+    }    // namespace
+#endif
+
     scheduler_base::scheduler_base(std::size_t num_threads,
         char const* description, thread_queue_init_parameters thread_queue_init,
         scheduler_mode mode)
@@ -58,6 +68,8 @@ namespace hpx { namespace threads { namespace policies {
         {
             data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
+            data.data_.spin_count_ = initial_idle_spin_count;
+            data.data_.spin_success_rate_ = 0;
         }
 #endif
 
@@ -68,8 +80,12 @@ namespace hpx { namespace threads { namespace policies {
     void scheduler_base::idle_callback(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::enable_idle_backoff)
+        scheduler_mode const mode = mode_.data_.load(std::memory_order_relaxed);
+        if (mode & policies::enable_idle_parking)
+        {
+            park_idle_thread(num_thread);
+        }
+        else if (mode & policies::enable_idle_backoff)
         {
             // Put this thread to sleep for some time, additionally it gets
             // woken up on new work.
@@ -103,10 +119,89 @@ namespace hpx { namespace threads { namespace policies {
     void scheduler_base::do_some_work(std::size_t)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        cond_.notify_all();
+        if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::enable_idle_parking)
+        {
+            // wake up exactly one parked thread (if any)
+            idle_parking_.notify_one();
+        }
+        else
+        {
+            cond_.notify_all();
+        }
 #endif
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    // Spin for some time polling for new work, then park the calling OS
+    // thread until new work is announced by do_some_work. The number of
+    // spinning iterations adapts to how often spinning was successful
+    // recently: threads which regularly find work while spinning spin
+    // longer, threads which don't are parked sooner.
+    void scheduler_base::park_idle_thread(std::size_t num_thread)
+    {
+        idle_backoff_data& data = wait_counts_[num_thread].data_;
+
+        bool found_work = false;
+        for (std::uint32_t i = 0; i != data.spin_count_; ++i)
+        {
+            if (get_queue_length() != 0)
+            {
+                found_work = true;
+                break;
+            }
+            HPX_SMT_PAUSE;
+        }
+
+        // moving average of the spin success rate, scaled to [0, 256]
+        data.spin_success_rate_ -= data.spin_success_rate_ / 8;
+        if (found_work)
+            data.spin_success_rate_ += 32;
+
+        if (data.spin_success_rate_ > 128)
+        {
+            data.spin_count_ =
+                (std::min)(2 * data.spin_count_, max_idle_spin_count);
+        }
+        else if (data.spin_success_rate_ < 64)
+        {
+            data.spin_count_ =
+                (std::max)(data.spin_count_ / 2, min_idle_spin_count);
+        }
+
+        if (found_work)
+            return;
+
+        // announce that this thread is about to be parked and check again
+        // for work to avoid missing a wake-up
+        concurrency::event_count::key_type key = idle_parking_.prepare_wait();
+        if (get_queue_length() != 0 ||
+            states_[num_thread].load(std::memory_order_relaxed) >=
+                state_pre_sleep)
+        {
+            idle_parking_.cancel_wait();
+            return;
+        }
+
+        // the timeout bounds the time it takes to notice work which was made
+        // available without calling do_some_work
+        idle_parking_.wait(key,
+            std::chrono::milliseconds(
+                std::lround(data.max_idle_backoff_time_)));
+    }
+#endif
+
+    void scheduler_base::create_threads(
+        std::vector<thread_init_data>& data, error_code& ec)
+    {
+        for (thread_init_data& d : data)
+        {
+            create_thread(d, nullptr, ec);
+            if (ec)
+                return;
+        }
+    }
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -253,6 +348,11 @@ namespace hpx { namespace threads { namespace policies {
         {
             state.store(s);
         }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // parked threads have to observe the new state
+        idle_parking_.notify_all();
+#endif
     }
 
     void scheduler_base::set_all_states_at_least(hpx::state s)
@@ -265,6 +365,11 @@ namespace hpx { namespace threads { namespace policies {
                 state.store(s);
             }
         }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // parked threads have to observe the new state
+        idle_parking_.notify_all();
+#endif
     }
 
     // return whether all states are at least at the given one
@@ -312,6 +417,11 @@ namespace hpx { namespace threads { namespace policies {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
         do_some_work(std::size_t(-1));
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // parked threads have to observe the new mode
+        idle_parking_.notify_all();
+#endif
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
@@ -0,0 +1,234 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/stack_size_tracking.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace hpx { namespace threads {
+    namespace detail {
+        bool stack_size_tracking_enabled = false;
+
+        namespace {
+            ///////////////////////////////////////////////////////////////////
+            // Fixed size, insert-only, open-addressing hash table mapping a
+            // thread description (the address of its name or of the thread
+            // function) to the largest stack high-water mark seen so far.
+            // Lookups and updates are lock-free. Once the table is full new
+            // descriptions are not tracked anymore.
+            class high_water_marks
+            {
+                static constexpr std::size_t table_size = 4096;
+                static constexpr std::size_t max_probes = 16;
+
+                struct entry
+                {
+                    std::atomic<std::size_t> key_;
+                    std::atomic<std::size_t> high_water_mark_;
+                };
+
+                static std::size_t hash(std::size_t key) noexcept
+                {
+                    // Fibonacci hashing, the lower bits of addresses are
+                    // mostly zero
+                    return static_cast<std::size_t>(
+                               (key * 0x9e3779b97f4a7c15ull) >> 32) %
+                        table_size;
+                }
+
+            public:
+                high_water_marks()
+                  : promotions_(0)
+                  , demotions_(0)
+                {
+                    for (entry& e : entries_)
+                    {
+                        e.key_.store(0, std::memory_order_relaxed);
+                        e.high_water_mark_.store(0, std::memory_order_relaxed);
+                    }
+                }
+
+                void update(std::size_t key, std::size_t high_water_mark)
+                {
+                    std::size_t pos = hash(key);
+                    for (std::size_t i = 0; i != max_probes; ++i)
+                    {
+                        entry& e = entries_[(pos + i) % table_size];
+
+                        std::size_t k = e.key_.load(std::memory_order_acquire);
+                        if (k == 0 &&
+                            e.key_.compare_exchange_strong(
+                                k, key, std::memory_order_acq_rel))
+                        {
+                            k = key;
+                        }
+
+                        if (k == key)
+                        {
+                            std::size_t current = e.high_water_mark_.load(
+                                std::memory_order_relaxed);
+                            while (current < high_water_mark &&
+                                !e.high_water_mark_.compare_exchange_weak(
+                                    current, high_water_mark,
+                                    std::memory_order_relaxed))
+                            {
+                            }
+                            return;
+                        }
+                    }
+                }
+
+                std::size_t find(std::size_t key) const
+                {
+                    std::size_t pos = hash(key);
+                    for (std::size_t i = 0; i != max_probes; ++i)
+                    {
+                        entry const& e = entries_[(pos + i) % table_size];
+
+                        std::size_t k = e.key_.load(std::memory_order_acquire);
+                        if (k == key)
+                            return e.high_water_mark_.load(
+                                std::memory_order_relaxed);
+                        if (k == 0)
+                            break;
+                    }
+                    return 0;
+                }
+
+                std::atomic<std::int64_t> promotions_;
+                std::atomic<std::int64_t> demotions_;
+
+            private:
+                entry entries_[table_size];
+            };
+
+            high_water_marks& get_high_water_marks()
+            {
+                static high_water_marks marks;
+                return marks;
+            }
+
+            std::size_t get_key(util::thread_description const& desc)
+            {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+                if (desc.kind() == util::thread_description::data_type_address)
+                    return desc.get_address();
+
+                // threads which are not annotated all share the same
+                // description, don't track those
+                char const* name = desc.get_description();
+                if (name == nullptr || std::strcmp(name, "<unknown>") == 0)
+                    return 0;
+                return reinterpret_cast<std::size_t>(name);
+#else
+                return 0;
+#endif
+            }
+        }    // namespace
+
+        void record_stack_high_water_mark(
+            util::thread_description const& desc,
+            std::ptrdiff_t high_water_mark)
+        {
+            std::size_t key = get_key(desc);
+            if (key == 0 || high_water_mark <= 0)
+                return;
+
+            get_high_water_marks().update(
+                key, static_cast<std::size_t>(high_water_mark));
+        }
+
+        thread_stacksize adapt_stacksize(policies::scheduler_base* scheduler,
+            util::thread_description const& desc, thread_stacksize stacksize)
+        {
+            // only the explicit stack sizes are adapted
+            if (stacksize < thread_stacksize_small ||
+                stacksize > thread_stacksize_huge)
+            {
+                return stacksize;
+            }
+
+            std::size_t key = get_key(desc);
+            if (key == 0)
+                return stacksize;
+
+            high_water_marks& marks = get_high_water_marks();
+
+            std::size_t high_water_mark = marks.find(key);
+            if (high_water_mark == 0)
+                return stacksize;
+
+            // leave a safety margin of 25%
+            std::size_t required = high_water_mark + high_water_mark / 4;
+
+            thread_stacksize adapted = thread_stacksize_huge;
+            for (int s = thread_stacksize_small; s != thread_stacksize_huge;
+                 ++s)
+            {
+                if (static_cast<std::size_t>(scheduler->get_stack_size(
+                        static_cast<thread_stacksize>(s))) >= required)
+                {
+                    adapted = static_cast<thread_stacksize>(s);
+                    break;
+                }
+            }
+
+            if (adapted > stacksize)
+                ++marks.promotions_;
+            else if (adapted < stacksize)
+                ++marks.demotions_;
+
+            return adapted;
+        }
+    }    // namespace detail
+
+    void set_stack_size_tracking_enabled(bool enable)
+    {
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+        coroutines::detail::posix::track_stack_high_water_mark = enable;
+#endif
+        detail::stack_size_tracking_enabled = enable;
+    }
+
+    bool get_stack_size_tracking_enabled()
+    {
+        return detail::stack_size_tracking_enabled;
+    }
+
+    std::size_t get_stack_high_water_mark(util::thread_description const& desc)
+    {
+        std::size_t key = detail::get_key(desc);
+        if (key == 0)
+            return 0;
+
+        return detail::get_high_water_marks().find(key);
+    }
+
+    std::int64_t get_stack_size_promotion_count(bool reset)
+    {
+        return util::get_and_reset_value(
+            detail::get_high_water_marks().promotions_, reset);
+    }
+
+    std::int64_t get_stack_size_demotion_count(bool reset)
+    {
+        return util::get_and_reset_value(
+            detail::get_high_water_marks().demotions_, reset);
+    }
+}}    // namespace hpx::threads
@@ -80,7 +80,10 @@ int main(int argc, char** argv)
         "abp-priority-lifo",
 #endif
 #if defined(HPX_HAVE_SHARED_PRIOIRITY_SCHEDULER)
-        "shared-priority"
+        "shared-priority",
+#endif
+#if defined(HPX_HAVE_WORK_STEALING_SCHEDULER)
+        "work-stealing",
 #endif
     };
     for (auto const& scheduler : schedulers)
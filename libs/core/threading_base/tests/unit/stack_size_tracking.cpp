@@ -0,0 +1,123 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that hpx.stacks.auto_size promotes and demotes the stack sizes of
+// annotated HPX threads based on their measured stack usage.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION) && defined(__linux__) &&              \
+    defined(HPX_HAVE_THREAD_STACK_MMAP) &&                                     \
+    !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES) &&                           \
+    !defined(HPX_HAVE_ADDRESS_SANITIZER)
+#define HPX_STACK_SIZE_TRACKING_SUPPORTED
+#endif
+
+char const* const stack_hungry_name = "stack_hungry";
+char const* const stack_frugal_name = "stack_frugal";
+
+///////////////////////////////////////////////////////////////////////////////
+// uses more stack space than a medium stack provides
+constexpr std::size_t stack_hungry_size = HPX_MEDIUM_STACK_SIZE;
+
+hpx::threads::thread_stacksize stack_hungry()
+{
+    volatile char buffer[stack_hungry_size];
+    for (std::size_t i = 0; i < stack_hungry_size; i += 512)
+        buffer[i] = 1;
+
+    return hpx::threads::get_self_stacksize_enum();
+}
+
+hpx::threads::thread_stacksize stack_frugal()
+{
+    return hpx::threads::get_self_stacksize_enum();
+}
+
+// The futures become ready before the threads have terminated and their
+// stack usage has been recorded.
+void wait_for_high_water_mark(char const* name)
+{
+#if defined(HPX_STACK_SIZE_TRACKING_SUPPORTED)
+    hpx::util::thread_description desc(name);
+    while (hpx::threads::get_stack_high_water_mark(desc) == 0)
+    {
+        hpx::this_thread::yield();
+    }
+#endif
+}
+
+int hpx_main()
+{
+    using hpx::threads::thread_stacksize;
+
+    HPX_TEST(hpx::threads::get_stack_size_tracking_enabled());
+
+    hpx::execution::parallel_executor small_exec(
+        hpx::threads::thread_stacksize_small);
+    hpx::execution::parallel_executor large_exec(
+        hpx::threads::thread_stacksize_large);
+
+    // run a thread which uses more than a medium stack
+    thread_stacksize s = hpx::async(large_exec,
+        hpx::util::annotated_function(&stack_hungry, stack_hungry_name))
+                             .get();
+    HPX_TEST_EQ(s, hpx::threads::thread_stacksize_large);
+    wait_for_high_water_mark(stack_hungry_name);
+
+    // run a thread which uses almost no stack
+    s = hpx::async(large_exec,
+        hpx::util::annotated_function(&stack_frugal, stack_frugal_name))
+            .get();
+    HPX_TEST_EQ(s, hpx::threads::thread_stacksize_large);
+    wait_for_high_water_mark(stack_frugal_name);
+
+#if defined(HPX_STACK_SIZE_TRACKING_SUPPORTED)
+    std::int64_t promotions =
+        hpx::threads::get_stack_size_promotion_count(false);
+    std::int64_t demotions = hpx::threads::get_stack_size_demotion_count(false);
+
+    // later threads with the same annotation are created with a fitting
+    // stack size, regardless of the requested one
+    s = hpx::async(small_exec,
+        hpx::util::annotated_function(&stack_hungry, stack_hungry_name))
+            .get();
+    HPX_TEST_EQ(s, hpx::threads::thread_stacksize_large);
+    HPX_TEST_EQ(hpx::threads::get_stack_size_promotion_count(false),
+        promotions + 1);
+
+    s = hpx::async(large_exec,
+        hpx::util::annotated_function(&stack_frugal, stack_frugal_name))
+            .get();
+    HPX_TEST_EQ(s, hpx::threads::thread_stacksize_small);
+    HPX_TEST_EQ(
+        hpx::threads::get_stack_size_demotion_count(false), demotions + 1);
+#else
+    HPX_UNUSED(small_exec);
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.stacks.auto_size!=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -178,6 +178,10 @@ namespace hpx {
         strm << "  HPX_AGAS_LOCAL_CACHE_SIZE=" << HPX_AGAS_LOCAL_CACHE_SIZE
              << "\n";
 #endif
+#if defined(HPX_AGAS_LOCAL_CACHE_SHARDS)
+        strm << "  HPX_AGAS_LOCAL_CACHE_SHARDS=" << HPX_AGAS_LOCAL_CACHE_SHARDS
+             << "\n";
+#endif
 #if defined(HPX_HAVE_MALLOC)
         strm << "  HPX_HAVE_MALLOC=" << HPX_HAVE_MALLOC << "\n";
 #endif
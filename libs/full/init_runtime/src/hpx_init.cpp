@@ -51,6 +51,7 @@
 #include <hpx/string_util/classification.hpp>
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
+#include <hpx/threading_base/stack_size_tracking.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/util/from_string.hpp>
 
@@ -361,7 +362,13 @@ namespace hpx {
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cms.rtcfg_.use_stack_guard_pages();
+            threads::coroutines::detail::posix::stack_pool_size =
+                cms.rtcfg_.get_stack_pool_size();
+            threads::coroutines::detail::posix::stack_pool_low_watermark =
+                cms.rtcfg_.get_stack_pool_low_watermark();
 #endif
+            threads::set_stack_size_tracking_enabled(
+                cms.rtcfg_.get_stack_auto_size());
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cms.rtcfg_.enable_lock_detection())
             {
@@ -81,6 +81,12 @@ char const* const locality_counter_names[] = {
     "/threads/count/stack-unbinds",
 #endif
 #endif
+#if !defined(HPX_WINDOWS) && defined(HPX_HAVE_THREAD_STACK_MMAP)
+    "/threads/count/stack-pool-hits",
+    "/threads/count/stack-pool-misses",
+#endif
+    "/threads/count/stack-promotions",
+    "/threads/count/stack-demotions",
     "/scheduler/utilization/instantaneous", nullptr};
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -148,6 +148,9 @@ namespace hpx { namespace resource { namespace detail {
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::work_stealing:
+            sched = "work_stealing";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -466,6 +469,10 @@ namespace hpx { namespace resource { namespace detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 == std::string("work-stealing").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::work_stealing;
+        }
         else
         {
             throw hpx::detail::command_line_error(
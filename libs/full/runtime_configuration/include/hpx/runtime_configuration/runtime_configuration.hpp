@@ -82,6 +82,10 @@ namespace hpx { namespace util {
         std::size_t get_agas_local_cache_size(
             std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SIZE) const;
 
+        // Get the number of shards of the AGAS client-side local cache
+        std::size_t get_agas_local_cache_shards(
+            std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SHARDS) const;
+
         bool get_agas_caching_mode() const;
 
         bool get_agas_range_caching_mode() const;
@@ -112,6 +116,13 @@ namespace hpx { namespace util {
         bool use_stack_guard_pages() const;
 #endif
 
+        // Returns the high and low watermarks of the process-wide stack cache
+        std::size_t get_stack_pool_size() const;
+        std::size_t get_stack_pool_low_watermark() const;
+
+        // Returns whether stack sizes are adapted to the observed usage
+        bool get_stack_auto_size() const;
+
         // return trace_depth for stack-backtraces
         std::size_t trace_depth() const;
 
@@ -226,6 +226,9 @@ namespace hpx { namespace util {
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
 #endif
+            "pool_size = ${HPX_STACK_POOL_SIZE:0}",
+            "pool_low_watermark = ${HPX_STACK_POOL_LOW_WATERMARK:0}",
+            "auto_size = ${HPX_STACK_AUTO_SIZE:0}",
 
             "[hpx.threadpools]",
 #if defined(HPX_HAVE_IO_POOL)
@@ -315,6 +318,8 @@ namespace hpx { namespace util {
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
+            "local_cache_shards = ${HPX_AGAS_LOCAL_CACHE_SHARDS:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SHARDS)) "}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
 
@@ -924,6 +929,26 @@ namespace hpx { namespace util {
         return cache_size;
     }
 
+    std::size_t runtime_configuration::get_agas_local_cache_shards(
+        std::size_t dflt) const
+    {
+        std::size_t num_shards = dflt;
+
+        if (has_section("hpx.agas"))
+        {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec)
+            {
+                num_shards = hpx::util::get_entry_as<std::size_t>(
+                    *sec, "local_cache_shards", num_shards);
+            }
+        }
+
+        if (num_shards == 0)
+            num_shards = 1;    // limit lower bound
+        return num_shards;
+    }
+
     bool runtime_configuration::get_agas_caching_mode() const
     {
         if (has_section("hpx.agas"))
@@ -1216,6 +1241,47 @@ namespace hpx { namespace util {
     }
 #endif
 
+    std::size_t runtime_configuration::get_stack_pool_size() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "pool_size", 0);
+            }
+        }
+        return 0;    // default is no stack cache
+    }
+
+    std::size_t runtime_configuration::get_stack_pool_low_watermark() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "pool_low_watermark", 0);
+            }
+        }
+        return 0;
+    }
+
+    bool runtime_configuration::get_stack_auto_size() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<int>(*sec, "auto_size", 0) != 0;
+            }
+        }
+        return false;    // default is to use the requested stack sizes
+    }
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
@@ -14,6 +14,7 @@
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -41,12 +42,40 @@ namespace hpx { namespace parallel { inline namespace v1 {
             }
 
             template <typename ExPolicy, typename InIter, typename Pred>
-            static InIter sequential(
-                ExPolicy, InIter first, InIter last, Pred&& op)
+            static typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                InIter>::type
+            sequential(ExPolicy, InIter first, InIter last, Pred&& op)
             {
                 return std::adjacent_find(first, last, op);
             }
 
+            template <typename ExPolicy, typename InIter, typename Pred>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                InIter>::type
+            sequential(ExPolicy, InIter first, InIter last, Pred&& op)
+            {
+                if (first == last)
+                    return last;
+
+                InIter next = first;
+                ++next;
+                std::size_t count = std::distance(next, last);
+
+                std::size_t adj_find_res = sequential_find_first_n<ExPolicy>(
+                    hpx::util::make_zip_iterator(first, next), count,
+                    [&op](auto&& t) {
+                        return op(hpx::get<0>(t), hpx::get<1>(t));
+                    });
+
+                if (adj_find_res == count)
+                    return last;
+
+                std::advance(first, adj_find_res);
+                return first;
+            }
+
             template <typename ExPolicy, typename FwdIter, typename Pred>
             static
                 typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
@@ -54,7 +83,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     ExPolicy&& policy, FwdIter first, FwdIter last, Pred&& op)
             {
                 typedef hpx::util::zip_iterator<FwdIter, FwdIter> zip_iterator;
-                typedef typename zip_iterator::reference reference;
                 typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
 
@@ -72,11 +100,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [op = std::forward<Pred>(op), tok](zip_iterator it,
                               std::size_t part_size,
                               std::size_t base_idx) mutable {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&op, &tok](reference t, std::size_t i) {
-                            using hpx::get;
-                            if (op(get<0>(t), get<1>(t)))
-                                tok.cancel(i);
+                    find_first_in_partition<ExPolicy>(it, part_size, base_idx,
+                        tok, [&op](auto&& t) {
+                            return op(hpx::get<0>(t), hpx::get<1>(t));
                         });
                 };
 
@@ -7,7 +7,16 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/execution/traits/vector_pack_count_bits.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/util/cancellation_token.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
 
 namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
@@ -55,4 +64,50 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         }
         return last;
     }
+
+    // Find the first element of the partition [it, it + part_size) for which
+    // the predicate holds and store its index in the cancellation token. For
+    // the datapar execution policies the predicate is applied to whole vector
+    // packs and yields a mask, the first element set in the mask is found.
+    template <typename ExPolicy, typename Iter, typename Token, typename Pred>
+    inline void find_first_in_partition(Iter it, std::size_t part_size,
+        std::size_t base_idx, Token& tok, Pred&& pred)
+    {
+        util::loop_idx_n<ExPolicy>(base_idx, it, part_size, tok,
+            [&pred, &tok](auto&& v, std::size_t i) -> void {
+                int const offset =
+                    traits::find_first_set(hpx::util::invoke(pred, v));
+                if (offset != -1)
+                {
+                    tok.cancel(i + offset);
+                }
+            });
+    }
+
+    // Sequential search used by the datapar execution policies, returns the
+    // number of elements preceding the first element for which the predicate
+    // holds.
+    template <typename ExPolicy, typename Iter, typename Pred>
+    inline std::size_t sequential_find_first_n(
+        Iter first, std::size_t count, Pred&& pred)
+    {
+        util::cancellation_token<std::size_t> tok(count);
+        find_first_in_partition<ExPolicy>(
+            first, count, 0, tok, std::forward<Pred>(pred));
+        return tok.get_data();
+    }
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename Pred>
+    inline Iter sequential_find_first(Iter first, Sent last, Pred&& pred)
+    {
+        std::size_t count = detail::distance(first, last);
+        std::size_t find_res = sequential_find_first_n<ExPolicy>(
+            first, count, std::forward<Pred>(pred));
+        if (find_res != count)
+        {
+            std::advance(first, find_res);
+            return first;
+        }
+        return detail::advance_to_sentinel(first, last);
+    }
 }}}}    // namespace hpx::parallel::v1::detail
@@ -180,6 +180,7 @@ namespace hpx {
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -227,14 +228,41 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename Iter1, typename Sent1,
                 typename Iter2, typename Sent2, typename F, typename Proj1,
                 typename Proj2>
-            static bool sequential(ExPolicy, Iter1 first1, Sent1 last1,
-                Iter2 first2, Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
+            static typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                bool>::type
+            sequential(ExPolicy, Iter1 first1, Sent1 last1, Iter2 first2,
+                Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
             {
                 return sequential_equal_binary(first1, last1, first2, last2,
                     std::forward<F>(f), std::forward<Proj1>(proj1),
                     std::forward<Proj2>(proj2));
             }
 
+            template <typename ExPolicy, typename Iter1, typename Sent1,
+                typename Iter2, typename Sent2, typename F, typename Proj1,
+                typename Proj2>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                bool>::type
+            sequential(ExPolicy, Iter1 first1, Sent1 last1, Iter2 first2,
+                Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
+            {
+                std::size_t count1 = detail::distance(first1, last1);
+                if (count1 != std::size_t(detail::distance(first2, last2)))
+                {
+                    return false;
+                }
+
+                return sequential_find_first_n<ExPolicy>(
+                           hpx::util::make_zip_iterator(first1, first2), count1,
+                           [&f, &proj1, &proj2](auto&& t) {
+                               return !hpx::util::invoke(f,
+                                   hpx::util::invoke(proj1, hpx::get<0>(t)),
+                                   hpx::util::invoke(proj2, hpx::get<1>(t)));
+                           }) == count1;
+            }
+
             template <typename ExPolicy, typename Iter1, typename Sent1,
                 typename Iter2, typename Sent2, typename F, typename Proj1,
                 typename Proj2>
@@ -276,36 +304,34 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
 
                 typedef hpx::util::zip_iterator<Iter1, Iter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
-                util::cancellation_token<> tok;
+                // the position of the first mismatch is tracked, which allows
+                // for whole vector packs to be compared for the datapar
+                // execution policies
+                util::cancellation_token<std::size_t> tok(count1);
                 auto f1 = [tok, f = std::forward<F>(f),
                               proj1 = std::forward<Proj1>(proj1),
                               proj2 = std::forward<Proj2>(proj2)](
-                              zip_iterator it,
-                              std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(it, part_count, tok,
-                        [&f, &proj1, &proj2, &tok](zip_iterator const& curr) {
-                            reference t = *curr;
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::invoke(proj1, hpx::get<0>(t)),
-                                    hpx::util::invoke(proj2, hpx::get<1>(t))))
-                            {
-                                tok.cancel();
-                            }
+                              zip_iterator it, std::size_t part_count,
+                              std::size_t base_idx) mutable -> void {
+                    find_first_in_partition<ExPolicy>(it, part_count, base_idx,
+                        tok, [&f, &proj1, &proj2](auto&& t) {
+                            return !hpx::util::invoke(f,
+                                hpx::util::invoke(proj1, hpx::get<0>(t)),
+                                hpx::util::invoke(proj2, hpx::get<1>(t)));
                         });
-                    return !tok.was_cancelled();
                 };
 
-                return util::partitioner<ExPolicy, bool>::call(
+                auto f2 = [tok, count1](
+                              std::vector<hpx::future<void>>&&) -> bool {
+                    return static_cast<difference_type1>(tok.get_data()) ==
+                        count1;
+                };
+
+                return util::partitioner<ExPolicy, bool, void>::call_with_index(
                     std::forward<ExPolicy>(policy),
-                    hpx::util::make_zip_iterator(first1, first2), count1,
-                    std::move(f1),
-                    [](std::vector<hpx::future<bool>>&& results) -> bool {
-                        return std::all_of(hpx::util::begin(results),
-                            hpx::util::end(results),
-                            [](hpx::future<bool>& val) { return val.get(); });
-                    });
+                    hpx::util::make_zip_iterator(first1, first2), count1, 1,
+                    std::move(f1), std::move(f2));
             }
         };
         /// \endcond
@@ -355,12 +381,32 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename InIter1, typename InIter2,
                 typename F>
-            static bool sequential(
+            static typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                bool>::type
+            sequential(
                 ExPolicy, InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
             {
                 return std::equal(first1, last1, first2, std::forward<F>(f));
             }
 
+            template <typename ExPolicy, typename InIter1, typename InIter2,
+                typename F>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                bool>::type
+            sequential(
+                ExPolicy, InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
+            {
+                std::size_t count = std::distance(first1, last1);
+                return sequential_find_first_n<ExPolicy>(
+                           hpx::util::make_zip_iterator(first1, first2), count,
+                           [&f](auto&& t) {
+                               return !hpx::util::invoke(
+                                   f, hpx::get<0>(t), hpx::get<1>(t));
+                           }) == count;
+            }
+
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
                 typename F>
             static typename util::detail::algorithm_result<ExPolicy, bool>::type
@@ -379,32 +425,27 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
-
-                util::cancellation_token<> tok;
-                auto f1 = [f, tok](zip_iterator it,
-                              std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(it, part_count, tok,
-                        [&f, &tok](zip_iterator const& curr) {
-                            reference t = *curr;
-                            if (!hpx::util::invoke(
-                                    f, hpx::get<0>(t), hpx::get<1>(t)))
-                            {
-                                tok.cancel();
-                            }
+
+                util::cancellation_token<std::size_t> tok(count);
+                auto f1 = [f, tok](zip_iterator it, std::size_t part_count,
+                              std::size_t base_idx) mutable -> void {
+                    find_first_in_partition<ExPolicy>(it, part_count, base_idx,
+                        tok, [&f](auto&& t) {
+                            return !hpx::util::invoke(
+                                f, hpx::get<0>(t), hpx::get<1>(t));
                         });
-                    return !tok.was_cancelled();
                 };
 
-                return util::partitioner<ExPolicy, bool>::call(
+                auto f2 = [tok, count](
+                              std::vector<hpx::future<void>>&&) -> bool {
+                    return static_cast<difference_type>(tok.get_data()) ==
+                        count;
+                };
+
+                return util::partitioner<ExPolicy, bool, void>::call_with_index(
                     std::forward<ExPolicy>(policy),
-                    hpx::util::make_zip_iterator(first1, first2), count,
-                    std::move(f1),
-                    [](std::vector<hpx::future<bool>>&& results) {
-                        return std::all_of(hpx::util::begin(results),
-                            hpx::util::end(results),
-                            [](hpx::future<bool>& val) { return val.get(); });
-                    });
+                    hpx::util::make_zip_iterator(first1, first2), count, 1,
+                    std::move(f1), std::move(f2));
             }
         };
         /// \endcond
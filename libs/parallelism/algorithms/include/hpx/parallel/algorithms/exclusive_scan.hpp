@@ -130,7 +130,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                     // MSVC 2015 fails if op is captured by reference
                     util::loop_n<ExPolicy>(
-                        dst, part_size - 1, [=, &val](FwdIter2 it) {
+                        dst, part_size - 1, [=, &val](auto it) {
                             *it = hpx::util::invoke(op, val, *it);
                         });
                 };
@@ -258,11 +258,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 parallel(ExPolicy&& policy, FwdIter first, std::size_t count,
                     T const& val)
             {
-                typedef typename std::iterator_traits<FwdIter>::value_type type;
-
+                // v is a vector pack if the given policy is a datapar policy
                 return for_each_n<FwdIter>().call(
                     std::forward<ExPolicy>(policy), std::false_type(), first,
-                    count, [val](type& v) -> void { v = val; },
+                    count, [val](auto& v) -> void { v = val; },
                     util::projection_identity());
             }
         };
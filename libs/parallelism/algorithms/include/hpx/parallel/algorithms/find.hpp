@@ -385,6 +385,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/invoke_projected.hpp>
@@ -429,13 +430,30 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename T, typename Proj = util::projection_identity>
-            static constexpr Iter sequential(ExPolicy, Iter first, Sent last,
-                T const& val, Proj&& proj = Proj())
+            static constexpr typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                Iter>::type
+            sequential(ExPolicy, Iter first, Sent last, T const& val,
+                Proj&& proj = Proj())
             {
                 return sequential_find(
                     first, last, val, std::forward<Proj>(proj));
             }
 
+            template <typename ExPolicy, typename Iter, typename Sent,
+                typename T, typename Proj = util::projection_identity>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                Iter>::type
+            sequential(ExPolicy, Iter first, Sent last, T const& val,
+                Proj&& proj = Proj())
+            {
+                return sequential_find_first<ExPolicy>(
+                    first, last, [&val, &proj](auto&& v) {
+                        return hpx::util::invoke(proj, v) == val;
+                    });
+            }
+
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename T, typename Proj = util::projection_identity>
             static typename util::detail::algorithm_result<ExPolicy, Iter>::type
@@ -443,7 +461,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -456,12 +473,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [val, proj = std::forward<Proj>(proj), tok](Iter it,
                               std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&val, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (hpx::util::invoke(proj, v) == val)
-                            {
-                                tok.cancel(i);
-                            }
+                    find_first_in_partition<ExPolicy>(it, part_size, base_idx,
+                        tok, [&val, &proj](auto&& v) {
+                            return hpx::util::invoke(proj, v) == val;
                         });
                 };
 
@@ -556,13 +570,31 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename F, typename Proj = util::projection_identity>
-            static constexpr Iter sequential(
+            static constexpr typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                Iter>::type
+            sequential(
                 ExPolicy, Iter first, Sent last, F&& f, Proj&& proj = Proj())
             {
                 return sequential_find_if(
                     first, last, std::forward<F>(f), std::forward<Proj>(proj));
             }
 
+            template <typename ExPolicy, typename Iter, typename Sent,
+                typename F, typename Proj = util::projection_identity>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                Iter>::type
+            sequential(
+                ExPolicy, Iter first, Sent last, F&& f, Proj&& proj = Proj())
+            {
+                return sequential_find_first<ExPolicy>(
+                    first, last, [&f, &proj](auto&& v) {
+                        return hpx::util::invoke(
+                            f, hpx::util::invoke(proj, v));
+                    });
+            }
+
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename F, typename Proj = util::projection_identity>
             static typename util::detail::algorithm_result<ExPolicy, Iter>::type
@@ -570,7 +602,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -584,13 +615,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj = std::forward<Proj>(proj),
                               tok](Iter it, std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&f, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (hpx::util::invoke(
-                                    f, hpx::util::invoke(proj, v)))
-                            {
-                                tok.cancel(i);
-                            }
+                    find_first_in_partition<ExPolicy>(it, part_size, base_idx,
+                        tok, [&f, &proj](auto&& v) {
+                            return hpx::util::invoke(
+                                f, hpx::util::invoke(proj, v));
                         });
                 };
 
@@ -690,13 +718,31 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename F, typename Proj = util::projection_identity>
-            static constexpr Iter sequential(
+            static constexpr typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                Iter>::type
+            sequential(
                 ExPolicy, Iter first, Sent last, F&& f, Proj&& proj = Proj())
             {
                 return sequential_find_if_not(
                     first, last, std::forward<F>(f), std::forward<Proj>(proj));
             }
 
+            template <typename ExPolicy, typename Iter, typename Sent,
+                typename F, typename Proj = util::projection_identity>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                Iter>::type
+            sequential(
+                ExPolicy, Iter first, Sent last, F&& f, Proj&& proj = Proj())
+            {
+                return sequential_find_first<ExPolicy>(
+                    first, last, [&f, &proj](auto&& v) {
+                        return !hpx::util::invoke(
+                            f, hpx::util::invoke(proj, v));
+                    });
+            }
+
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename F, typename Proj = util::projection_identity>
             static typename util::detail::algorithm_result<ExPolicy, Iter>::type
@@ -704,7 +750,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -718,13 +763,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj = std::forward<Proj>(proj),
                               tok](Iter it, std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&f, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (!hpx::util::invoke(
-                                    f, hpx::util::invoke(proj, v)))
-                            {
-                                tok.cancel(i);
-                            }
+                    find_first_in_partition<ExPolicy>(it, part_size, base_idx,
+                        tok, [&f, &proj](auto&& v) {
+                            return !hpx::util::invoke(
+                                f, hpx::util::invoke(proj, v));
                         });
                 };
 
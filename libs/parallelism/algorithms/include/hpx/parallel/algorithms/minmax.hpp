@@ -19,6 +19,7 @@
 #include <hpx/parallel/util/tagged_pair.hpp>
 
 #include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/traits/vector_pack_count_bits.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/tagspec.hpp>
@@ -42,7 +43,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \cond NOINTERNAL
         template <typename ExPolicy, typename FwdIter, typename F,
             typename Proj>
-        FwdIter sequential_min_element(ExPolicy&& policy, FwdIter it,
+        typename std::enable_if<
+            !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+            FwdIter>::type
+        sequential_min_element(ExPolicy&& policy, FwdIter it,
             std::size_t count, F const& f, Proj const& proj)
         {
             if (count == 0 || count == 1)
@@ -61,6 +65,44 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return smallest;
         }
 
+        // For the datapar execution policies whole vector packs are compared
+        // with the current minimum. The first element which is smaller than
+        // the current minimum becomes the new minimum, this is repeated until
+        // no element of the pack is smaller.
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        typename std::enable_if<
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value, FwdIter>::type
+        sequential_min_element(ExPolicy&& policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            // the position of a new minimum is computed from the beginning
+            // of the sequence, which requires random access iterators
+            if (!hpx::traits::is_random_access_iterator<FwdIter>::value)
+            {
+                return sequential_min_element(
+                    hpx::execution::seq, it, count, f, proj);
+            }
+
+            if (count == 0 || count == 1)
+                return it;
+
+            FwdIter smallest = it;
+            util::loop_idx_n<typename std::decay<ExPolicy>::type>(1,
+                std::next(it), count - 1,
+                [&f, &smallest, &proj, it](auto&& v, std::size_t i) -> void {
+                    int offset = -1;
+                    while ((offset = traits::find_first_set(hpx::util::invoke(
+                                f, hpx::util::invoke(proj, v),
+                                hpx::util::invoke(proj, *smallest)))) != -1)
+                    {
+                        smallest = std::next(it, i + offset);
+                    }
+                });
+
+            return smallest;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct min_element : public detail::algorithm<min_element<Iter>, Iter>
@@ -100,7 +142,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
-            static FwdIter sequential(
+            static typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                FwdIter>::type
+            sequential(
                 ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
             {
                 return std::min_element(first, last,
@@ -108,6 +153,18 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         std::forward<F>(f), std::forward<Proj>(proj)));
             }
 
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                FwdIter>::type
+            sequential(ExPolicy policy, FwdIter first, FwdIter last, F&& f,
+                Proj&& proj)
+            {
+                return sequential_min_element(policy, first,
+                    std::distance(first, last), f, proj);
+            }
+
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
             static
@@ -258,7 +315,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \cond NOINTERNAL
         template <typename ExPolicy, typename FwdIter, typename F,
             typename Proj>
-        FwdIter sequential_max_element(ExPolicy&& policy, FwdIter it,
+        typename std::enable_if<
+            !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+            FwdIter>::type
+        sequential_max_element(ExPolicy&& policy, FwdIter it,
             std::size_t count, F const& f, Proj const& proj)
         {
             if (count == 0 || count == 1)
@@ -277,6 +337,39 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return greatest;
         }
 
+        // see sequential_min_element above
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        typename std::enable_if<
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value, FwdIter>::type
+        sequential_max_element(ExPolicy&& policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            if (!hpx::traits::is_random_access_iterator<FwdIter>::value)
+            {
+                return sequential_max_element(
+                    hpx::execution::seq, it, count, f, proj);
+            }
+
+            if (count == 0 || count == 1)
+                return it;
+
+            FwdIter greatest = it;
+            util::loop_idx_n<typename std::decay<ExPolicy>::type>(1,
+                std::next(it), count - 1,
+                [&f, &greatest, &proj, it](auto&& v, std::size_t i) -> void {
+                    int offset = -1;
+                    while ((offset = traits::find_first_set(hpx::util::invoke(
+                                f, hpx::util::invoke(proj, *greatest),
+                                hpx::util::invoke(proj, v)))) != -1)
+                    {
+                        greatest = std::next(it, i + offset);
+                    }
+                });
+
+            return greatest;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct max_element : public detail::algorithm<max_element<Iter>, Iter>
@@ -316,7 +409,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
-            static FwdIter sequential(
+            static typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                FwdIter>::type
+            sequential(
                 ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
             {
                 return std::max_element(first, last,
@@ -324,6 +420,18 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         std::forward<F>(f), std::forward<Proj>(proj)));
             }
 
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                FwdIter>::type
+            sequential(ExPolicy policy, FwdIter first, FwdIter last, F&& f,
+                Proj&& proj)
+            {
+                return sequential_max_element(policy, first,
+                    std::distance(first, last), f, proj);
+            }
+
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
             static
@@ -475,8 +583,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \cond NOINTERNAL
         template <typename ExPolicy, typename FwdIter, typename F,
             typename Proj>
-        std::pair<FwdIter, FwdIter> sequential_minmax_element(ExPolicy&& policy,
-            FwdIter it, std::size_t count, F const& f, Proj const& proj)
+        typename std::enable_if<
+            !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+            std::pair<FwdIter, FwdIter>>::type
+        sequential_minmax_element(ExPolicy&& policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
         {
             std::pair<FwdIter, FwdIter> result(it, it);
 
@@ -501,6 +612,59 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return result;
         }
 
+        // see sequential_min_element above, the maximum is the last of the
+        // largest elements
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        typename std::enable_if<
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+            std::pair<FwdIter, FwdIter>>::type
+        sequential_minmax_element(ExPolicy&& policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            if (!hpx::traits::is_random_access_iterator<FwdIter>::value)
+            {
+                return sequential_minmax_element(
+                    hpx::execution::seq, it, count, f, proj);
+            }
+
+            std::pair<FwdIter, FwdIter> result(it, it);
+
+            if (count == 0 || count == 1)
+                return result;
+
+            util::loop_idx_n<typename std::decay<ExPolicy>::type>(1,
+                std::next(it), count - 1,
+                [&f, &result, &proj, it](auto&& v, std::size_t i) -> void {
+                    int offset = -1;
+                    while ((offset = traits::find_first_set(hpx::util::invoke(
+                                f, hpx::util::invoke(proj, v),
+                                hpx::util::invoke(proj, *result.first)))) != -1)
+                    {
+                        result.first = std::next(it, i + offset);
+                    }
+
+                    // move to the largest element of the pack first, then
+                    // pick the last element which is equal to it
+                    while ((offset = traits::find_first_set(hpx::util::invoke(
+                                f, hpx::util::invoke(proj, *result.second),
+                                hpx::util::invoke(proj, v)))) != -1)
+                    {
+                        result.second = std::next(it, i + offset);
+                    }
+
+                    offset = traits::find_last_set(!hpx::util::invoke(f,
+                        hpx::util::invoke(proj, v),
+                        hpx::util::invoke(proj, *result.second)));
+                    if (offset != -1)
+                    {
+                        result.second = std::next(it, i + offset);
+                    }
+                });
+
+            return result;
+        }
+
         template <typename Iter>
         struct minmax_element
           : public detail::algorithm<minmax_element<Iter>,
@@ -548,7 +712,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
-            static std::pair<FwdIter, FwdIter> sequential(
+            static typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                std::pair<FwdIter, FwdIter>>::type
+            sequential(
                 ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
             {
                 return std::minmax_element(first, last,
@@ -556,6 +723,18 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         std::forward<F>(f), std::forward<Proj>(proj)));
             }
 
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                std::pair<FwdIter, FwdIter>>::type
+            sequential(ExPolicy policy, FwdIter first, FwdIter last, F&& f,
+                Proj&& proj)
+            {
+                return sequential_minmax_element(policy, first,
+                    std::distance(first, last), f, proj);
+            }
+
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
             static typename util::detail::algorithm_result<ExPolicy,
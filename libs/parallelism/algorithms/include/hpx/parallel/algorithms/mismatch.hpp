@@ -181,6 +181,7 @@ namespace hpx {
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -227,15 +228,43 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename Iter1, typename Sent1,
                 typename Iter2, typename Sent2, typename F, typename Proj1,
                 typename Proj2>
-            static util::in_in_result<Iter1, Iter2> sequential(ExPolicy,
-                Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f,
-                Proj1&& proj1, Proj2&& proj2)
+            static typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                util::in_in_result<Iter1, Iter2>>::type
+            sequential(ExPolicy, Iter1 first1, Sent1 last1, Iter2 first2,
+                Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
             {
                 return sequential_mismatch_binary(first1, last1, first2, last2,
                     std::forward<F>(f), std::forward<Proj1>(proj1),
                     std::forward<Proj2>(proj2));
             }
 
+            template <typename ExPolicy, typename Iter1, typename Sent1,
+                typename Iter2, typename Sent2, typename F, typename Proj1,
+                typename Proj2>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                util::in_in_result<Iter1, Iter2>>::type
+            sequential(ExPolicy, Iter1 first1, Sent1 last1, Iter2 first2,
+                Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
+            {
+                std::size_t count = (std::min)(
+                    static_cast<std::size_t>(detail::distance(first1, last1)),
+                    static_cast<std::size_t>(detail::distance(first2, last2)));
+
+                std::size_t mismatched = sequential_find_first_n<ExPolicy>(
+                    hpx::util::make_zip_iterator(first1, first2), count,
+                    [&f, &proj1, &proj2](auto&& t) {
+                        return !hpx::util::invoke(f,
+                            hpx::util::invoke(proj1, hpx::get<0>(t)),
+                            hpx::util::invoke(proj2, hpx::get<1>(t)));
+                    });
+
+                std::advance(first1, mismatched);
+                std::advance(first2, mismatched);
+                return {first1, first2};
+            }
+
             template <typename ExPolicy, typename Iter1, typename Sent1,
                 typename Iter2, typename Sent2, typename F, typename Proj1,
                 typename Proj2>
@@ -273,7 +302,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
 
                 typedef hpx::util::zip_iterator<Iter1, Iter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count1);
 
@@ -282,14 +310,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj2 = std::forward<Proj2>(proj2)](
                               zip_iterator it, std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &proj1, &proj2, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::invoke(proj1, hpx::get<0>(t)),
-                                    hpx::util::invoke(proj2, hpx::get<1>(t))))
-                            {
-                                tok.cancel(i);
-                            }
+                    find_first_in_partition<ExPolicy>(it, part_count, base_idx,
+                        tok, [&f, &proj1, &proj2](auto&& t) {
+                            return !hpx::util::invoke(f,
+                                hpx::util::invoke(proj1, hpx::get<0>(t)),
+                                hpx::util::invoke(proj2, hpx::get<1>(t)));
                         });
                 };
 
@@ -383,12 +408,35 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename InIter1, typename InIter2,
                 typename F>
-            static IterPair sequential(
+            static typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                IterPair>::type
+            sequential(
                 ExPolicy, InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
             {
                 return std::mismatch(first1, last1, first2, std::forward<F>(f));
             }
 
+            template <typename ExPolicy, typename InIter1, typename InIter2,
+                typename F>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                IterPair>::type
+            sequential(
+                ExPolicy, InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
+            {
+                std::size_t mismatched = sequential_find_first_n<ExPolicy>(
+                    hpx::util::make_zip_iterator(first1, first2),
+                    std::distance(first1, last1), [&f](auto&& t) {
+                        return !hpx::util::invoke(
+                            f, hpx::get<0>(t), hpx::get<1>(t));
+                    });
+
+                std::advance(first1, mismatched);
+                std::advance(first2, mismatched);
+                return std::make_pair(first1, first2);
+            }
+
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
                 typename F>
             static typename util::detail::algorithm_result<ExPolicy,
@@ -408,20 +456,16 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count);
 
                 auto f1 = [tok, f = std::forward<F>(f)](zip_iterator it,
                               std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(
-                                    f, hpx::get<0>(t), hpx::get<1>(t)))
-                            {
-                                tok.cancel(i);
-                            }
+                    find_first_in_partition<ExPolicy>(it, part_count, base_idx,
+                        tok, [&f](auto&& t) {
+                            return !hpx::util::invoke(
+                                f, hpx::get<0>(t), hpx::get<1>(t));
                         });
                 };
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
@@ -16,11 +16,13 @@
 #include <hpx/type_support/unused.hpp>
 
 #include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/for_each.hpp>
 #include <hpx/parallel/tagspec.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -60,13 +62,33 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename InIter, typename T1,
                 typename T2, typename Proj>
-            static InIter sequential(ExPolicy, InIter first, InIter last,
+            static typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                InIter>::type
+            sequential(ExPolicy, InIter first, InIter last,
                 T1 const& old_value, T2 const& new_value, Proj&& proj)
             {
                 return sequential_replace(first, last, old_value, new_value,
                     std::forward<Proj>(proj));
             }
 
+            template <typename ExPolicy, typename InIter, typename T1,
+                typename T2, typename Proj>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                InIter>::type
+            sequential(ExPolicy, InIter first, InIter last,
+                T1 const& old_value, T2 const& new_value, Proj&& proj)
+            {
+                return util::loop_n<typename std::decay<ExPolicy>::type>(first,
+                    std::distance(first, last),
+                    [&old_value, &new_value, &proj](auto const& it) -> void {
+                        traits::mask_assign(
+                            hpx::util::invoke(proj, *it) == old_value, *it,
+                            new_value);
+                    });
+            }
+
             template <typename ExPolicy, typename FwdIter, typename T1,
                 typename T2, typename Proj>
             static
@@ -74,17 +96,15 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
                     T1 const& old_value, T2 const& new_value, Proj&& proj)
             {
-                typedef typename std::iterator_traits<FwdIter>::value_type type;
-
+                // t is a vector pack if the given policy is a datapar policy
                 return for_each_n<FwdIter>().call(
                     std::forward<ExPolicy>(policy), std::false_type(), first,
                     std::distance(first, last),
                     [old_value, new_value, proj = std::forward<Proj>(proj)](
-                        type& t) -> void {
-                        if (hpx::util::invoke(proj, t) == old_value)
-                        {
-                            t = new_value;
-                        }
+                        auto& t) -> void {
+                        traits::mask_assign(
+                            hpx::util::invoke(proj, t) == old_value, t,
+                            new_value);
                     },
                     util::projection_identity());
             }
@@ -195,13 +215,33 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename InIter, typename F,
                 typename T, typename Proj>
-            static InIter sequential(ExPolicy, InIter first, InIter last, F&& f,
+            static typename std::enable_if<
+                !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                InIter>::type
+            sequential(ExPolicy, InIter first, InIter last, F&& f,
                 T const& new_value, Proj&& proj)
             {
                 return sequential_replace_if(first, last, std::forward<F>(f),
                     new_value, std::forward<Proj>(proj));
             }
 
+            template <typename ExPolicy, typename InIter, typename F,
+                typename T, typename Proj>
+            static typename std::enable_if<
+                hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+                InIter>::type
+            sequential(ExPolicy, InIter first, InIter last, F&& f,
+                T const& new_value, Proj&& proj)
+            {
+                return util::loop_n<typename std::decay<ExPolicy>::type>(first,
+                    std::distance(first, last),
+                    [&f, &new_value, &proj](auto const& it) -> void {
+                        using hpx::util::invoke;
+                        traits::mask_assign(
+                            invoke(f, invoke(proj, *it)), *it, new_value);
+                    });
+            }
+
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename T, typename Proj>
             static
@@ -209,16 +249,15 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 parallel(ExPolicy&& policy, FwdIter first, FwdIter last, F&& f,
                     T const& new_value, Proj&& proj)
             {
-                typedef typename std::iterator_traits<FwdIter>::value_type type;
-
+                // t is a vector pack if the given policy is a datapar policy
                 return for_each_n<FwdIter>().call(
                     std::forward<ExPolicy>(policy), std::false_type(), first,
                     std::distance(first, last),
                     [new_value, f = std::forward<F>(f),
-                        proj = std::forward<Proj>(proj)](type& t) -> void {
+                        proj = std::forward<Proj>(proj)](auto& t) -> void {
                         using hpx::util::invoke;
-                        if (invoke(f, invoke(proj, t)))
-                            t = new_value;
+                        traits::mask_assign(
+                            invoke(f, invoke(proj, t)), t, new_value);
                     },
                     util::projection_identity());
             }
@@ -132,7 +132,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     *dst++ = val;
 
                     util::loop_n<ExPolicy>(
-                        dst, part_size - 1, [&op, &val](FwdIter2 it) -> void {
+                        dst, part_size - 1, [&op, &val](auto it) -> void {
                             *it = hpx::util::invoke(op, val, *it);
                         });
                 };
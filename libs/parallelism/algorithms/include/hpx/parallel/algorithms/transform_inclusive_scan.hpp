@@ -153,7 +153,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
 
                     util::loop_n<ExPolicy>(
-                        dst, part_size, [&op, &val](FwdIter2 it) -> void {
+                        dst, part_size, [&op, &val](auto it) -> void {
                             *it = hpx::util::invoke(op, val, *it);
                         });
                 };
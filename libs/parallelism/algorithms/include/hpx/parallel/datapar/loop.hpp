@@ -15,6 +15,8 @@
 #include <hpx/execution/traits/vector_pack_load_store.hpp>
 #include <hpx/execution/traits/vector_pack_type.hpp>
 #include <hpx/executors/datapar/execution_policy_fwd.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/type_support/decay.hpp>
@@ -31,6 +33,17 @@ namespace hpx { namespace parallel { namespace util {
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
 
+        // the non-datapar loops are used for sequences which can't be
+        // vectorized
+        template <typename Iterator>
+        struct loop;
+
+        template <typename Iterator>
+        struct loop_n;
+
+        template <typename IterCat>
+        struct loop_idx_n;
+
         ///////////////////////////////////////////////////////////////////////
         template <typename ExPolicy, typename Vector>
         HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
@@ -97,7 +110,7 @@ namespace hpx { namespace parallel { namespace util {
             typename std::enable_if<
                 iterator_datapar_compatible<Iter>::value>::type>
         {
-            template <typename Iter_>
+            template <typename Iter_, typename Sent_>
             static bool call(Iter_ const& first, Sent_ const& last)
             {
                 typedef
@@ -105,7 +118,7 @@ namespace hpx { namespace parallel { namespace util {
                 typedef typename traits::vector_pack_type<value_type>::type V;
 
                 return traits::vector_pack_size<V>::value <=
-                    (std::size_t) detail::distance(first, last);
+                    (std::size_t) parallel::v1::detail::distance(first, last);
             }
         };
 
@@ -119,13 +132,15 @@ namespace hpx { namespace parallel { namespace util {
             typedef typename std::iterator_traits<iterator_type>::value_type
                 value_type;
 
-            typedef typename traits::vector_pack_type<value_type> V;
-
             template <typename Begin, typename End, typename F>
             HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
                 iterator_datapar_compatible<Begin>::value, Begin>::type
             call(Begin first, End last, F&& f)
             {
+                typedef typename traits::vector_pack_type<value_type>::type V;
+                typedef typename std::iterator_traits<Begin>::difference_type
+                    difference_type;
+
                 while (is_data_aligned(first) && first != last)
                 {
                     datapar_loop_step<Begin>::call1(f, first);
@@ -134,8 +149,7 @@ namespace hpx { namespace parallel { namespace util {
                 static std::size_t constexpr size =
                     traits::vector_pack_size<V>::value;
 
-                End const lastV = last - (size + 1);
-                while (first < lastV)
+                while (last - first >= difference_type(size))
                 {
                     datapar_loop_step<Begin>::callv(f, first);
                 }
@@ -150,7 +164,9 @@ namespace hpx { namespace parallel { namespace util {
 
             template <typename Begin, typename End, typename F>
             HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
-                !iterator_datapar_compatible<Begin>::value, Begin>::type
+                !iterator_datapar_compatible<Begin>::value &&
+                    iterator_datapar_compatible_impl<Begin>::value,
+                Begin>::type
             call(Begin it, End end, F&& f)
             {
                 while (it != end)
@@ -159,6 +175,17 @@ namespace hpx { namespace parallel { namespace util {
                 }
                 return it;
             }
+
+            // sequences of elements which can't be put into vector packs are
+            // handled the same way as for the non-datapar policies
+            template <typename Begin, typename End, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                !iterator_datapar_compatible_impl<Begin>::value, Begin>::type
+            call(Begin it, End end, F&& f)
+            {
+                return util::detail::loop<Begin>::call(
+                    it, end, std::forward<F>(f));
+            }
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -237,13 +264,13 @@ namespace hpx { namespace parallel { namespace util {
             typedef typename std::iterator_traits<iterator_type>::value_type
                 value_type;
 
-            typedef typename traits::vector_pack_type<value_type>::type V;
-
             template <typename InIter, typename F>
             HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
                 iterator_datapar_compatible<InIter>::value, InIter>::type
             call(InIter first, std::size_t count, F&& f)
             {
+                typedef typename traits::vector_pack_type<value_type>::type V;
+
                 std::size_t len = count;
 
                 for (/* */; detail::is_data_aligned(first) && len != 0; --len)
@@ -254,8 +281,7 @@ namespace hpx { namespace parallel { namespace util {
                 static std::size_t constexpr size =
                     traits::vector_pack_size<V>::value;
 
-                for (std::int64_t lenV = std::int64_t(count - (size + 1));
-                     lenV > 0; lenV -= size, len -= size)
+                for (/* */; len >= size; len -= size)
                 {
                     datapar_loop_step<InIter>::callv(f, first);
                 }
@@ -270,7 +296,9 @@ namespace hpx { namespace parallel { namespace util {
 
             template <typename InIter, typename F>
             HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
-                !iterator_datapar_compatible<InIter>::value, InIter>::type
+                !iterator_datapar_compatible<InIter>::value &&
+                    iterator_datapar_compatible_impl<InIter>::value,
+                InIter>::type
             call(InIter first, std::size_t count, F&& f)
             {
                 for (/* */; count != 0; --count)
@@ -279,6 +307,112 @@ namespace hpx { namespace parallel { namespace util {
                 }
                 return first;
             }
+
+            template <typename InIter, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                !iterator_datapar_compatible_impl<InIter>::value, InIter>::type
+            call(InIter first, std::size_t count, F&& f)
+            {
+                using pred = std::integral_constant<bool,
+                    hpx::traits::is_random_access_iterator<InIter>::value>;
+
+                return util::detail::loop_n<InIter>::call(
+                    first, count, std::forward<F>(f), pred());
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Helper class to repeatedly call a function passing the elements
+        // together with their index. Whole vector packs are passed together
+        // with the index of their first element, the elements are not written
+        // back to the sequence. The packs are always loaded using unaligned
+        // loads as the zipped sequences are in general not aligned to the same
+        // boundary (e.g. for adjacent_find).
+        template <typename Iterator>
+        struct datapar_loop_idx_n
+        {
+            typedef typename hpx::util::decay<Iterator>::type iterator_type;
+            typedef typename std::iterator_traits<iterator_type>::value_type
+                value_type;
+
+            template <typename InIter, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                iterator_datapar_compatible<InIter>::value, InIter>::type
+            call(std::size_t base_idx, InIter it, std::size_t count, F&& f)
+            {
+                typedef typename traits::vector_pack_type<value_type>::type V;
+
+                static std::size_t constexpr size =
+                    traits::vector_pack_size<V>::value;
+
+                for (/* */; count >= size; count -= size, base_idx += size)
+                {
+                    V tmp =
+                        traits::vector_pack_load<V, value_type>::unaligned(it);
+                    f(tmp, base_idx);
+                    std::advance(it, size);
+                }
+
+                for (/* */; count != 0; (void) --count, ++it, ++base_idx)
+                {
+                    f(*it, base_idx);
+                }
+                return it;
+            }
+
+            template <typename InIter, typename CancelToken, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                iterator_datapar_compatible<InIter>::value, InIter>::type
+            call(std::size_t base_idx, InIter it, std::size_t count,
+                CancelToken& tok, F&& f)
+            {
+                typedef typename traits::vector_pack_type<value_type>::type V;
+
+                static std::size_t constexpr size =
+                    traits::vector_pack_size<V>::value;
+
+                for (/* */; count >= size; count -= size, base_idx += size)
+                {
+                    if (tok.was_cancelled(base_idx))
+                        return it;
+
+                    V tmp =
+                        traits::vector_pack_load<V, value_type>::unaligned(it);
+                    f(tmp, base_idx);
+                    std::advance(it, size);
+                }
+
+                for (/* */; count != 0; (void) --count, ++it, ++base_idx)
+                {
+                    if (tok.was_cancelled(base_idx))
+                        break;
+                    f(*it, base_idx);
+                }
+                return it;
+            }
+
+            template <typename InIter, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                !iterator_datapar_compatible<InIter>::value, InIter>::type
+            call(std::size_t base_idx, InIter it, std::size_t count, F&& f)
+            {
+                typedef typename std::iterator_traits<InIter>::iterator_category
+                    cat;
+                return util::detail::loop_idx_n<cat>::call(
+                    base_idx, it, count, std::forward<F>(f));
+            }
+
+            template <typename InIter, typename CancelToken, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                !iterator_datapar_compatible<InIter>::value, InIter>::type
+            call(std::size_t base_idx, InIter it, std::size_t count,
+                CancelToken& tok, F&& f)
+            {
+                typedef typename std::iterator_traits<InIter>::iterator_category
+                    cat;
+                return util::detail::loop_idx_n<cat>::call(
+                    base_idx, it, count, tok, std::forward<F>(f));
+            }
         };
     }    // namespace detail
 
@@ -319,7 +453,7 @@ namespace hpx { namespace parallel { namespace util {
     ///////////////////////////////////////////////////////////////////////////
     template <typename Begin, typename End, typename F>
     HPX_HOST_DEVICE HPX_FORCEINLINE Begin loop(
-        parallel::execution::datapar_policy, Begin begin, End end, F&& f)
+        hpx::execution::datapar_policy, Begin begin, End end, F&& f)
     {
         return detail::datapar_loop<Begin>::call(
             begin, end, std::forward<F>(f));
@@ -327,7 +461,23 @@ namespace hpx { namespace parallel { namespace util {
 
     template <typename Begin, typename End, typename F>
     HPX_HOST_DEVICE HPX_FORCEINLINE Begin loop(
-        parallel::execution::datapar_task_policy, Begin begin, End end, F&& f)
+        hpx::execution::datapar_task_policy, Begin begin, End end, F&& f)
+    {
+        return detail::datapar_loop<Begin>::call(
+            begin, end, std::forward<F>(f));
+    }
+
+    template <typename Begin, typename End, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Begin loop(
+        hpx::execution::dataseq_policy, Begin begin, End end, F&& f)
+    {
+        return detail::datapar_loop<Begin>::call(
+            begin, end, std::forward<F>(f));
+    }
+
+    template <typename Begin, typename End, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Begin loop(
+        hpx::execution::dataseq_task_policy, Begin begin, End end, F&& f)
     {
         return detail::datapar_loop<Begin>::call(
             begin, end, std::forward<F>(f));
@@ -354,6 +504,27 @@ namespace hpx { namespace parallel { namespace util {
         return detail::datapar_loop_n<Iter>::call(
             it, count, std::forward<F>(f));
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, Iter>::type
+    loop_idx_n(std::size_t base_idx, Iter it, std::size_t count, F&& f)
+    {
+        return detail::datapar_loop_idx_n<Iter>::call(
+            base_idx, it, count, std::forward<F>(f));
+    }
+
+    template <typename ExPolicy, typename Iter, typename CancelToken,
+        typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, Iter>::type
+    loop_idx_n(std::size_t base_idx, Iter it, std::size_t count,
+        CancelToken& tok, F&& f)
+    {
+        return detail::datapar_loop_idx_n<Iter>::call(
+            base_idx, it, count, tok, std::forward<F>(f));
+    }
 }}}    // namespace hpx::parallel::util
 
 #endif
@@ -28,6 +28,22 @@
 #include <utility>
 
 namespace hpx { namespace parallel { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    // the vectorized loops below refer to each other
+    template <typename ExPolicy, typename Iter, typename OutIter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::pair<Iter, OutIter>>::type
+    transform_loop_n(Iter it, std::size_t count, OutIter dest, F&& f);
+
+    template <typename ExPolicy, typename InIter1, typename InIter2,
+        typename OutIter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        hpx::tuple<InIter1, InIter2, OutIter>>::type
+    transform_binary_loop_n(
+        InIter1 first1, std::size_t count, InIter2 first2, OutIter dest, F&& f);
+
     namespace detail {
         ///////////////////////////////////////////////////////////////////////
         template <typename Iterator>
@@ -79,7 +95,7 @@ namespace hpx { namespace parallel { namespace util {
                 std::pair<InIter, OutIter>>::type
             call(InIter first, std::size_t count, OutIter dest, F&& f)
             {
-                return util::transform_loop_n<sequenced_policy>(
+                return util::transform_loop_n<hpx::execution::sequenced_policy>(
                     first, count, dest, std::forward<F>(f));
             }
         };
@@ -104,7 +120,7 @@ namespace hpx { namespace parallel { namespace util {
             call(InIter first, InIter last, OutIter dest, F&& f)
             {
                 return util::transform_loop_n<
-                    parallel::execution::datapar_policy>(first,
+                    hpx::execution::datapar_policy>(first,
                     std::distance(first, last), dest, std::forward<F>(f));
             }
 
@@ -117,7 +133,7 @@ namespace hpx { namespace parallel { namespace util {
             call(InIter first, InIter last, OutIter dest, F&& f)
             {
                 return util::transform_loop(
-                    seq, first, last, dest, std::forward<F>(f));
+                    hpx::execution::seq, first, last, dest, std::forward<F>(f));
             }
         };
 
@@ -180,7 +196,8 @@ namespace hpx { namespace parallel { namespace util {
             call(InIter1 first1, std::size_t count, InIter2 first2,
                 OutIter dest, F&& f)
             {
-                return util::transform_binary_loop_n<sequenced_policy>(
+                return util::transform_binary_loop_n<
+                    hpx::execution::sequenced_policy>(
                     first1, count, first2, dest, std::forward<F>(f));
             }
         };
@@ -216,7 +233,7 @@ namespace hpx { namespace parallel { namespace util {
                 F&& f)
             {
                 return util::transform_binary_loop_n<
-                    parallel::execution::datapar_policy>(first1,
+                    hpx::execution::datapar_policy>(first1,
                     std::distance(first1, last1), first2, dest,
                     std::forward<F>(f));
             }
@@ -233,7 +250,8 @@ namespace hpx { namespace parallel { namespace util {
             call(InIter1 first1, InIter1 last1, InIter2 first2, OutIter dest,
                 F&& f)
             {
-                return util::transform_binary_loop<sequenced_policy>(
+                return util::transform_binary_loop<
+                    hpx::execution::sequenced_policy>(
                     first1, last1, first2, dest, std::forward<F>(f));
             }
 
@@ -253,7 +271,7 @@ namespace hpx { namespace parallel { namespace util {
                     std::distance(first1, last1), std::distance(first2, last2));
 
                 return util::transform_binary_loop_n<
-                    parallel::execution::datapar_policy>(
+                    hpx::execution::datapar_policy>(
                     first1, count, first2, dest, std::forward<F>(f));
             }
 
@@ -269,7 +287,8 @@ namespace hpx { namespace parallel { namespace util {
             call(InIter1 first1, InIter1 last1, InIter2 first2, InIter2 last2,
                 OutIter dest, F&& f)
             {
-                return util::transform_binary_loop<sequenced_policy>(
+                return util::transform_binary_loop<
+                    hpx::execution::sequenced_policy>(
                     first1, last1, first2, last2, dest, std::forward<F>(f));
             }
         };
@@ -289,7 +308,7 @@ namespace hpx { namespace parallel { namespace util {
     ///////////////////////////////////////////////////////////////////////////
     template <typename Iter, typename OutIter, typename F>
     HPX_HOST_DEVICE HPX_FORCEINLINE std::pair<Iter, OutIter> transform_loop(
-        parallel::execution::datapar_policy, Iter it, Iter end, OutIter dest,
+        hpx::execution::datapar_policy, Iter it, Iter end, OutIter dest,
         F&& f)
     {
         return detail::datapar_transform_loop<Iter>::call(
@@ -298,7 +317,7 @@ namespace hpx { namespace parallel { namespace util {
 
     template <typename Iter, typename OutIter, typename F>
     HPX_HOST_DEVICE HPX_FORCEINLINE std::pair<Iter, OutIter> transform_loop(
-        parallel::execution::datapar_task_policy, Iter it, Iter end,
+        hpx::execution::datapar_task_policy, Iter it, Iter end,
         OutIter dest, F&& f)
     {
         return detail::datapar_transform_loop<Iter>::call(
@@ -53,10 +53,27 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // all of the zipped sequences have to be vectorizable using vector packs
+    // of the same size
+    template <bool Arithmetic, typename... T>
+    struct zip_iterator_datapar_compatible : std::false_type
+    {
+    };
+
+    template <typename T0, typename... T>
+    struct zip_iterator_datapar_compatible<true, T0, T...>
+      : hpx::util::all_of<std::integral_constant<bool,
+            traits::vector_pack_size<T>::value ==
+                traits::vector_pack_size<T0>::value>...>
+    {
+    };
+
     template <typename... Iter>
     struct iterator_datapar_compatible_impl<hpx::util::zip_iterator<Iter...>>
-      : hpx::util::all_of<std::is_arithmetic<
-            typename std::iterator_traits<Iter>::value_type>...>
+      : zip_iterator_datapar_compatible<
+            hpx::util::all_of<std::is_arithmetic<
+                typename std::iterator_traits<Iter>::value_type>...>::value,
+            typename std::iterator_traits<Iter>::value_type...>
     {
     };
 }}}}    // namespace hpx::parallel::util::detail
@@ -614,17 +614,19 @@ namespace hpx { namespace parallel { namespace util {
         struct loop_idx_n<std::random_access_iterator_tag>
         {
             ///////////////////////////////////////////////////////////////////
-            // handle sequences of non-futures
+            // handle sequences of non-futures, the elements are accessed by
+            // dereferencing the iterator as the subscript operator may return
+            // a proxy (e.g. for zip_iterator)
             template <typename Iter, typename F>
             HPX_HOST_DEVICE HPX_FORCEINLINE static constexpr Iter call(
                 std::size_t base_idx, Iter it, std::size_t num, F&& f)
             {
                 while (num >= 4)
                 {
-                    f(it[0], base_idx++);
-                    f(it[1], base_idx++);
-                    f(it[2], base_idx++);
-                    f(it[3], base_idx++);
+                    f(*it, base_idx++);
+                    f(*(it + 1), base_idx++);
+                    f(*(it + 2), base_idx++);
+                    f(*(it + 3), base_idx++);
 
                     it += 4;
                     num -= 4;
@@ -633,18 +635,18 @@ namespace hpx { namespace parallel { namespace util {
                 switch (num)
                 {
                 case 3:
-                    f(it[0], base_idx++);
-                    f(it[1], base_idx++);
-                    f(it[2], base_idx);
+                    f(*it, base_idx++);
+                    f(*(it + 1), base_idx++);
+                    f(*(it + 2), base_idx);
                     break;
 
                 case 2:
-                    f(it[0], base_idx++);
-                    f(it[1], base_idx);
+                    f(*it, base_idx++);
+                    f(*(it + 1), base_idx);
                     break;
 
                 case 1:
-                    f(it[0], base_idx);
+                    f(*it, base_idx);
                     break;
 
                 default:
@@ -664,10 +666,10 @@ namespace hpx { namespace parallel { namespace util {
                     if (tok.was_cancelled(base_idx))
                         return it;
 
-                    f(it[0], base_idx++);
-                    f(it[1], base_idx++);
-                    f(it[2], base_idx++);
-                    f(it[3], base_idx++);
+                    f(*it, base_idx++);
+                    f(*(it + 1), base_idx++);
+                    f(*(it + 2), base_idx++);
+                    f(*(it + 3), base_idx++);
 
                     it += 4;
                     num -= 4;
@@ -676,18 +678,18 @@ namespace hpx { namespace parallel { namespace util {
                 switch (num)
                 {
                 case 3:
-                    f(it[0], base_idx++);
-                    f(it[1], base_idx++);
-                    f(it[2], base_idx);
+                    f(*it, base_idx++);
+                    f(*(it + 1), base_idx++);
+                    f(*(it + 2), base_idx);
                     break;
 
                 case 2:
-                    f(it[0], base_idx++);
-                    f(it[1], base_idx);
+                    f(*it, base_idx++);
+                    f(*(it + 1), base_idx);
                     break;
 
                 case 1:
-                    f(it[0], base_idx);
+                    f(*it, base_idx);
                     break;
 
                 default:
@@ -718,6 +720,31 @@ namespace hpx { namespace parallel { namespace util {
             base_idx, it, count, tok, std::forward<F>(f));
     }
 
+    // The overloads taking an execution policy allow for the datapar
+    // policies to pass whole vector packs (together with the index of their
+    // first element) to the function.
+    template <typename ExPolicy, typename Iter, typename F>
+    HPX_FORCEINLINE constexpr typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value, Iter>::type
+    loop_idx_n(std::size_t base_idx, Iter it, std::size_t count, F&& f)
+    {
+        typedef typename std::iterator_traits<Iter>::iterator_category cat;
+        return detail::loop_idx_n<cat>::call(
+            base_idx, it, count, std::forward<F>(f));
+    }
+
+    template <typename ExPolicy, typename Iter, typename CancelToken,
+        typename F>
+    HPX_FORCEINLINE constexpr typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value, Iter>::type
+    loop_idx_n(std::size_t base_idx, Iter it, std::size_t count,
+        CancelToken& tok, F&& f)
+    {
+        typedef typename std::iterator_traits<Iter>::iterator_category cat;
+        return detail::loop_idx_n<cat>::call(
+            base_idx, it, count, tok, std::forward<F>(f));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
         // Helper class to repeatedly call a function a given number of times
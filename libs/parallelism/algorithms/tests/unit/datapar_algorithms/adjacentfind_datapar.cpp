@@ -0,0 +1,133 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_adjacent_find.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T get_result(T t)
+{
+    return t;
+}
+
+template <typename T>
+T get_result(hpx::future<T> f)
+{
+    return f.get();
+}
+
+// The interesting element is placed at positions which exercise the unaligned
+// head, the vectorized body, and the scalar tail of the vectorized loops.
+std::vector<std::size_t> positions(std::size_t size)
+{
+    return std::vector<std::size_t>{0, 1, 3, 17, size / 2, size - 2,
+        size - 1, size};
+}
+
+struct equal_to
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 == t2)
+    {
+        return t1 == t2;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_adjacent_find(ExPolicy&& policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    for (std::size_t pos : positions(c.size() - 1))
+    {
+        std::iota(std::begin(c), std::end(c), std::rand() % 10000);
+        if (pos != c.size() - 1)
+        {
+            c[pos + 1] = c[pos];
+            if (pos + 6 < c.size())
+                c[pos + 6] = c[pos + 5];
+        }
+        else
+        {
+            pos = c.size();
+        }
+
+        iterator it = get_result(hpx::parallel::adjacent_find(policy,
+            iterator(std::begin(c)), iterator(std::end(c)), equal_to()));
+        HPX_TEST(it == iterator(std::begin(c) + pos));
+    }
+}
+
+template <typename IteratorTag>
+void test_adjacent_find()
+{
+    using namespace hpx::execution;
+
+    test_adjacent_find(dataseq, IteratorTag());
+    test_adjacent_find(datapar, IteratorTag());
+
+    test_adjacent_find(dataseq(task), IteratorTag());
+    test_adjacent_find(datapar(task), IteratorTag());
+}
+
+void adjacent_find_test()
+{
+    test_adjacent_find<std::random_access_iterator_tag>();
+    test_adjacent_find<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    adjacent_find_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,151 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_find.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+struct equal_to_one
+{
+    template <typename T>
+    auto operator()(T const& x) const -> decltype(x == 1)
+    {
+        return x == 1;
+    }
+};
+
+struct not_equal_to_one
+{
+    template <typename T>
+    auto operator()(T const& x) const -> decltype(x != 1)
+    {
+        return x != 1;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T get_result(T t)
+{
+    return t;
+}
+
+template <typename T>
+T get_result(hpx::future<T> f)
+{
+    return f.get();
+}
+
+// The searched element is placed at positions which exercise the unaligned
+// head, the vectorized body, and the scalar tail of the vectorized loops.
+std::vector<std::size_t> positions(std::size_t size)
+{
+    return std::vector<std::size_t>{0, 1, 3, 17, size / 2, size - 2,
+        size - 1, size};
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_find(ExPolicy&& policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    for (std::size_t pos : positions(c.size()))
+    {
+        std::fill(std::begin(c), std::end(c), std::rand() % 100 + 2);
+        if (pos != c.size())
+        {
+            c[pos] = 1;
+            if (pos + 5 < c.size())
+                c[pos + 5] = 1;
+        }
+
+        iterator it = get_result(hpx::find(
+            policy, iterator(std::begin(c)), iterator(std::end(c)), 1));
+        HPX_TEST(it == iterator(std::begin(c) + pos));
+
+        it = get_result(hpx::find_if(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), equal_to_one()));
+        HPX_TEST(it == iterator(std::begin(c) + pos));
+
+        // find_if_not on the inverted sequence
+        for (int& v : c)
+            v = (v == 1) ? 2 : 1;
+
+        it = get_result(hpx::find_if_not(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), equal_to_one()));
+        HPX_TEST(it == iterator(std::begin(c) + pos));
+
+        it = get_result(hpx::find_if(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), not_equal_to_one()));
+        HPX_TEST(it == iterator(std::begin(c) + pos));
+    }
+}
+
+template <typename IteratorTag>
+void test_find()
+{
+    using namespace hpx::execution;
+
+    test_find(dataseq, IteratorTag());
+    test_find(datapar, IteratorTag());
+
+    test_find(dataseq(task), IteratorTag());
+    test_find(datapar(task), IteratorTag());
+}
+
+void find_test()
+{
+    test_find<std::random_access_iterator_tag>();
+    test_find<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    find_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
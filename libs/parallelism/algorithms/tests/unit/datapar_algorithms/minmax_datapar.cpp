@@ -0,0 +1,143 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_minmax.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T get_result(T t)
+{
+    return t;
+}
+
+template <typename T>
+T get_result(hpx::future<T> f)
+{
+    return f.get();
+}
+
+// The interesting element is placed at positions which exercise the unaligned
+// head, the vectorized body, and the scalar tail of the vectorized loops.
+std::vector<std::size_t> positions(std::size_t size)
+{
+    return std::vector<std::size_t>{0, 1, 3, 17, size / 2, size - 2,
+        size - 1, size};
+}
+
+struct less
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 < t2)
+    {
+        return t1 < t2;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_minmax_element(ExPolicy&& policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    for (std::size_t pos : positions(c.size() - 2))
+    {
+        // the extrema occur twice, the first minimum and the first and last
+        // maximum are expected
+        std::generate(std::begin(c), std::end(c),
+            []() { return std::rand() % 10000 + 1; });
+        c[pos] = 0;
+        c[pos + 1] = 20000;
+        c[(pos + 7) % c.size()] = 0;
+        c[(pos + 9) % c.size()] = 20000;
+
+        base_iterator min_it = std::min_element(std::begin(c), std::end(c));
+        base_iterator max_it = std::max_element(std::begin(c), std::end(c));
+        auto minmax_it = std::minmax_element(std::begin(c), std::end(c));
+
+        iterator it = get_result(hpx::parallel::min_element(
+            policy, iterator(std::begin(c)), iterator(std::end(c)), less()));
+        HPX_TEST(it == iterator(min_it));
+
+        it = get_result(hpx::parallel::max_element(
+            policy, iterator(std::begin(c)), iterator(std::end(c)), less()));
+        HPX_TEST(it == iterator(max_it));
+
+        auto r = get_result(hpx::parallel::minmax_element(
+            policy, iterator(std::begin(c)), iterator(std::end(c)), less()));
+        HPX_TEST(r.first == iterator(minmax_it.first));
+        HPX_TEST(r.second == iterator(minmax_it.second));
+    }
+}
+
+template <typename IteratorTag>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    test_minmax_element(dataseq, IteratorTag());
+    test_minmax_element(datapar, IteratorTag());
+
+    test_minmax_element(dataseq(task), IteratorTag());
+    test_minmax_element(datapar(task), IteratorTag());
+}
+
+void minmax_element_test()
+{
+    test_minmax_element<std::random_access_iterator_tag>();
+    test_minmax_element<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    minmax_element_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,132 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/parallel_replace.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T get_result(T t)
+{
+    return t;
+}
+
+template <typename T>
+T get_result(hpx::future<T> f)
+{
+    return f.get();
+}
+
+struct equal_to_one
+{
+    template <typename T>
+    auto operator()(T const& x) const -> decltype(x == 1)
+    {
+        return x == 1;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_replace(ExPolicy&& policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    std::vector<int> d(c.size());
+
+    std::generate(
+        std::begin(c), std::end(c), []() { return std::rand() % 3; });
+    std::copy(std::begin(c), std::end(c), std::begin(d));
+    std::replace(std::begin(d), std::end(d), 1, 42);
+
+    get_result(hpx::parallel::replace(
+        policy, iterator(std::begin(c)), iterator(std::end(c)), 1, 42));
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d)));
+
+    std::replace(std::begin(d), std::end(d), 2, 1);
+    std::replace(std::begin(c), std::end(c), 2, 1);
+    std::replace(std::begin(d), std::end(d), 1, 43);
+
+    get_result(hpx::parallel::replace_if(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), equal_to_one(), 43));
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d)));
+
+    iterator it = get_result(
+        hpx::fill_n(policy, iterator(std::begin(c)), c.size(), 7));
+    HPX_TEST(it == iterator(std::end(c)));
+    HPX_TEST(std::count(std::begin(c), std::end(c), 7) ==
+        std::ptrdiff_t(c.size()));
+}
+
+template <typename IteratorTag>
+void test_replace()
+{
+    using namespace hpx::execution;
+
+    test_replace(dataseq, IteratorTag());
+    test_replace(datapar, IteratorTag());
+
+    test_replace(dataseq(task), IteratorTag());
+    test_replace(datapar(task), IteratorTag());
+}
+
+void replace_test()
+{
+    test_replace<std::random_access_iterator_tag>();
+    test_replace<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    replace_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
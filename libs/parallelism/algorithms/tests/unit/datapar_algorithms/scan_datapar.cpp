@@ -0,0 +1,127 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_scan.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T get_result(T t)
+{
+    return t;
+}
+
+template <typename T>
+T get_result(hpx::future<T> f)
+{
+    return f.get();
+}
+
+struct plus
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 + t2)
+    {
+        return t1 + t2;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_scan(ExPolicy&& policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    std::vector<int> d(c.size());
+    std::vector<int> e(c.size());
+
+    std::generate(
+        std::begin(c), std::end(c), []() { return std::rand() % 100; });
+
+    get_result(hpx::parallel::inclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), plus(), 10));
+    std::partial_sum(std::begin(c), std::end(c), std::begin(e));
+    for (int& v : e)
+        v += 10;
+    HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+
+    get_result(hpx::parallel::exclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), 10, plus()));
+    std::partial_sum(std::begin(c), std::end(c) - 1, std::begin(e) + 1);
+    e[0] = 0;
+    for (int& v : e)
+        v += 10;
+    HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+}
+
+template <typename IteratorTag>
+void test_scan()
+{
+    using namespace hpx::execution;
+
+    test_scan(dataseq, IteratorTag());
+    test_scan(datapar, IteratorTag());
+
+    test_scan(dataseq(task), IteratorTag());
+    test_scan(datapar(task), IteratorTag());
+}
+
+void scan_test()
+{
+    test_scan<std::random_access_iterator_tag>();
+    test_scan<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    scan_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -20,11 +20,11 @@ void test_transform_binary2()
 {
     using namespace hpx::execution;
 
-    test_transform_binary2(execution::dataseq, IteratorTag());
-    test_transform_binary2(execution::datapar, IteratorTag());
+    test_transform_binary2(dataseq, IteratorTag());
+    test_transform_binary2(datapar, IteratorTag());
 
-    test_transform_binary2_async(execution::dataseq(task), IteratorTag());
-    test_transform_binary2_async(execution::datapar(task), IteratorTag());
+    test_transform_binary2_async(dataseq(task), IteratorTag());
+    test_transform_binary2_async(datapar(task), IteratorTag());
 }
 
 void transform_binary2_test()
@@ -39,13 +39,13 @@ void test_transform_binary2_exception()
 {
     using namespace hpx::execution;
 
-    test_transform_binary2_exception(execution::dataseq, IteratorTag());
-    test_transform_binary2_exception(execution::datapar, IteratorTag());
+    test_transform_binary2_exception(dataseq, IteratorTag());
+    test_transform_binary2_exception(datapar, IteratorTag());
 
     test_transform_binary2_exception_async(
-        execution::dataseq(task), IteratorTag());
+        dataseq(task), IteratorTag());
     test_transform_binary2_exception_async(
-        execution::datapar(task), IteratorTag());
+        datapar(task), IteratorTag());
 }
 
 void transform_binary2_exception_test()
@@ -60,13 +60,13 @@ void test_transform_binary2_bad_alloc()
 {
     using namespace hpx::execution;
 
-    test_transform_binary2_bad_alloc(execution::dataseq, IteratorTag());
-    test_transform_binary2_bad_alloc(execution::datapar, IteratorTag());
+    test_transform_binary2_bad_alloc(dataseq, IteratorTag());
+    test_transform_binary2_bad_alloc(datapar, IteratorTag());
 
     test_transform_binary2_bad_alloc_async(
-        execution::dataseq(task), IteratorTag());
+        dataseq(task), IteratorTag());
     test_transform_binary2_bad_alloc_async(
-        execution::datapar(task), IteratorTag());
+        datapar(task), IteratorTag());
 }
 
 void transform_binary2_bad_alloc_test()
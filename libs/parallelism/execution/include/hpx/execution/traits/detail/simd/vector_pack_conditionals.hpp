@@ -0,0 +1,25 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD)
+#include <experimental/simd>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename V, typename U>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void mask_assign(
+        std::experimental::simd_mask<T, Abi> const& mask, V& target,
+        U const& value)
+    {
+        std::experimental::where(mask, target) = value;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,66 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD)
+
+#include <cstddef>
+#include <type_traits>
+
+#include <experimental/simd>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // specifying both, N and an Abi is not allowed
+        template <typename T, std::size_t N, typename Abi>
+        struct vector_pack_type
+        {
+            static_assert(std::is_void<Abi>::value,
+                "specifying both, N and an Abi is not allowed");
+
+            typedef std::experimental::simd<T,
+                std::experimental::simd_abi::fixed_size<N>>
+                type;
+        };
+
+        template <typename T, typename Abi>
+        struct vector_pack_type<T, 0, Abi>
+        {
+            typedef typename std::conditional<std::is_void<Abi>::value,
+                std::experimental::simd_abi::native<T>, Abi>::type abi_type;
+
+            typedef std::experimental::simd<T, abi_type> type;
+        };
+
+        template <typename T, typename Abi>
+        struct vector_pack_type<T, 1, Abi>
+        {
+            typedef std::experimental::simd<T,
+                std::experimental::simd_abi::scalar>
+                type;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N, typename Abi>
+    struct vector_pack_type : detail::vector_pack_type<T, N, Abi>
+    {
+    };
+
+    // don't wrap types twice
+    template <typename T, std::size_t N, typename Abi1, typename Abi2>
+    struct vector_pack_type<std::experimental::simd<T, Abi1>, N, Abi2>
+    {
+        typedef std::experimental::simd<T, Abi1> type;
+    };
+}}}    // namespace hpx::parallel::traits
+
+#endif
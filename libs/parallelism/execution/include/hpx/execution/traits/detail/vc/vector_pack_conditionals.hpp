@@ -0,0 +1,54 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <cstddef>
+
+#include <Vc/global.h>
+
+#if defined(Vc_IS_VERSION_1) && Vc_IS_VERSION_1
+
+#include <Vc/Vc>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename V, typename U>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void mask_assign(
+        Vc::Mask<T, Abi> const& mask, V& target, U const& value)
+    {
+        target(mask) = value;
+    }
+
+    template <typename T, std::size_t N, typename V0, std::size_t W,
+        typename V, typename U>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void mask_assign(
+        Vc::SimdMaskArray<T, N, V0, W> const& mask, V& target, U const& value)
+    {
+        target(mask) = value;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#else
+
+#include <Vc/datapar>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename V, typename U>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void mask_assign(
+        Vc::mask<T, Abi> const& mask, V& target, U const& value)
+    {
+        Vc::where(mask, target) = value;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif    // Vc_IS_VERSION_1
+
+#endif
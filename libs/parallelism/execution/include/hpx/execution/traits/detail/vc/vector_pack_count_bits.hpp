@@ -26,6 +26,25 @@ namespace hpx { namespace parallel { namespace traits {
     {
         return mask.count();
     }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_first_set(
+        Vc::Mask<T, Abi> const& mask)
+    {
+        return mask.isEmpty() ? -1 : mask.firstOne();
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_last_set(
+        Vc::Mask<T, Abi> const& mask)
+    {
+        for (int i = int(mask.size()) - 1; i >= 0; --i)
+        {
+            if (mask[i])
+                return i;
+        }
+        return -1;
+    }
 }}}    // namespace hpx::parallel::traits
 
 #else
@@ -40,6 +59,20 @@ namespace hpx { namespace parallel { namespace traits {
     {
         return Vc::popcount(mask);
     }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_first_set(
+        Vc::mask<T, Abi> const& mask)
+    {
+        return Vc::any_of(mask) ? Vc::find_first_set(mask) : -1;
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_last_set(
+        Vc::mask<T, Abi> const& mask)
+    {
+        return Vc::any_of(mask) ? Vc::find_last_set(mask) : -1;
+    }
 }}}    // namespace hpx::parallel::traits
 
 #endif    // Vc_IS_VERSION_1
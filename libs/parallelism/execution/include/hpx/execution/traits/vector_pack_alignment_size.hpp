@@ -69,6 +69,7 @@ namespace hpx { namespace parallel { namespace traits {
 }}}    // namespace hpx::parallel::traits
 
 #if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/simd/vector_pack_alignment_size.hpp>
 #include <hpx/execution/traits/detail/vc/vector_pack_alignment_size.hpp>
 #endif
 
@@ -0,0 +1,31 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    // Assign the given value to all elements of the target for which the
+    // corresponding element of the mask is set.
+    template <typename T, typename U>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void mask_assign(
+        bool mask, T& target, U const& value)
+    {
+        if (mask)
+            target = value;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/simd/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/detail/vc/vector_pack_conditionals.hpp>
+#endif
+
+#endif
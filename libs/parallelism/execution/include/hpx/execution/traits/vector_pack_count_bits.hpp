@@ -16,11 +16,24 @@ namespace hpx { namespace parallel { namespace traits {
     {
         return value ? 1 : 0;
     }
+
+    // Return the index of the first (last) element of the mask which is set,
+    // or -1 if no element is set.
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_first_set(bool value)
+    {
+        return value ? 0 : -1;
+    }
+
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_last_set(bool value)
+    {
+        return value ? 0 : -1;
+    }
 }}}    // namespace hpx::parallel::traits
 
 #if defined(HPX_HAVE_DATAPAR)
 
 #if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/simd/vector_pack_count_bits.hpp>
 #include <hpx/execution/traits/detail/vc/vector_pack_count_bits.hpp>
 #endif
 
@@ -25,6 +25,7 @@ namespace hpx { namespace parallel { namespace traits {
 }}}    // namespace hpx::parallel::traits
 
 #if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/simd/vector_pack_load_store.hpp>
 #include <hpx/execution/traits/detail/vc/vector_pack_load_store.hpp>
 #endif
 
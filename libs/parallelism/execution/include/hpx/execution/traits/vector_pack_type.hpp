@@ -36,6 +36,7 @@ namespace hpx { namespace parallel { namespace traits {
 }}}    // namespace hpx::parallel::traits
 
 #if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/simd/vector_pack_type.hpp>
 #include <hpx/execution/traits/detail/vc/vector_pack_type.hpp>
 #endif
 
@@ -26,7 +26,7 @@ int hpx_main()
             using var_type = typename hpx::util::decay<comp_type>::type;
 
             var_type mass_density = 0.0;
-            mass_density(mass_density > 0.0) = 7.0;
+            where(mass_density > 0.0, mass_density) = 7.0;
 
             HPX_TEST(all_of(mass_density == 0.0));
         });
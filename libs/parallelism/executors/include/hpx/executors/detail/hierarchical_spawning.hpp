@@ -17,24 +17,126 @@
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/fused_bulk_execute.hpp>
+#include <hpx/functional/deferred_call.hpp>
+#include <hpx/functional/invoke.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace parallel { namespace execution { namespace detail {
+    // The asynchronous tasks of a batch are not backed by a futures_factory
+    // as waiting on an unstarted task would run it inline on the waiting
+    // thread.
+    template <typename Result>
+    struct run_bulk_async_task
+    {
+        template <typename F, typename... Ts>
+        void operator()(
+            lcos::local::promise<Result>&& p, F&& f, Ts&&... ts) const
+        {
+            call(std::is_void<Result>(), p, f, ts...);
+        }
+
+    private:
+        template <typename F, typename... Ts>
+        static void call(std::false_type, lcos::local::promise<Result>& p,
+            F& f, Ts&... ts)
+        {
+            std::exception_ptr e;
+            try
+            {
+                p.set_value(HPX_INVOKE(f, ts...));
+                return;
+            }
+            catch (...)
+            {
+                e = std::current_exception();
+            }
+
+            // set_exception may yield, don't call it from the catch block
+            p.set_exception(std::move(e));
+        }
+
+        template <typename F, typename... Ts>
+        static void call(std::true_type, lcos::local::promise<Result>& p,
+            F& f, Ts&... ts)
+        {
+            std::exception_ptr e;
+            try
+            {
+                HPX_INVOKE(f, ts...);
+                p.set_value();
+                return;
+            }
+            catch (...)
+            {
+                e = std::current_exception();
+            }
+
+            // set_exception may yield, don't call it from the catch block
+            p.set_exception(std::move(e));
+        }
+    };
+
+    // Launch the tasks for the elements [part_begin, part_end) of the shape.
+    // Asynchronous tasks are handed to the scheduler as a single batch.
+    template <typename Result, typename F, typename Iter, typename... Ts>
+    void bulk_async_execute_part(threads::thread_pool_base* pool,
+        threads::thread_priority priority, threads::thread_stacksize stacksize,
+        threads::thread_schedule_hint hint, launch policy,
+        hpx::util::thread_description const& desc,
+        std::vector<hpx::future<Result>>& results, std::size_t part_begin,
+        std::size_t part_end, F& f, Iter it, Ts&... ts)
+    {
+        if (!hpx::detail::has_async_policy(policy) || policy == launch::fork)
+        {
+            for (std::size_t part_i = part_begin; part_i < part_end; ++part_i)
+            {
+                results[part_i] = hpx::detail::async_launch_policy_dispatch<
+                    decltype(policy)>::call(policy, pool, priority, stacksize,
+                    hint, f, *it, ts...);
+                ++it;
+            }
+            return;
+        }
+
+        std::vector<threads::thread_init_data> data;
+        data.reserve(part_end - part_begin);
+
+        for (std::size_t part_i = part_begin; part_i < part_end; ++part_i)
+        {
+            lcos::local::promise<Result> p;
+            results[part_i] = p.get_future();
+
+            data.emplace_back(threads::make_thread_function_nullary(
+                                  hpx::util::deferred_call(
+                                      run_bulk_async_task<Result>{},
+                                      std::move(p), f, *it, ts...)),
+                desc, priority, hint, stacksize, threads::pending);
+            ++it;
+        }
+
+        threads::register_work(data, pool);
+    }
+
     template <typename F, typename S, typename... Ts>
     std::vector<
         hpx::future<typename detail::bulk_function_result<F, S, Ts...>::type>>
@@ -50,9 +152,9 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
             "hpx::parallel::execution::detail::hierarchical_bulk_async_execute_"
             "helper");
 
-        typedef std::vector<hpx::future<
-            typename detail::bulk_function_result<F, S, Ts...>::type>>
-            result_type;
+        typedef typename detail::bulk_function_result<F, S, Ts...>::type
+            func_result_type;
+        typedef std::vector<hpx::future<func_result_type>> result_type;
 
         result_type results;
         std::size_t const size = hpx::util::size(shape);
@@ -75,15 +177,9 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
                     desc, pool, priority, threads::thread_stacksize_small, hint,
                     [&, hint, part_begin, part_end, part_size, f,
                         it]() mutable {
-                        for (std::size_t part_i = part_begin; part_i < part_end;
-                             ++part_i)
-                        {
-                            results[part_i] =
-                                hpx::detail::async_launch_policy_dispatch<
-                                    decltype(policy)>::call(policy, pool,
-                                    priority, stacksize, hint, f, *it, ts...);
-                            ++it;
-                        }
+                        bulk_async_execute_part<func_result_type>(pool,
+                            priority, stacksize, hint, policy, desc, results,
+                            part_begin, part_end, f, it, ts...);
                         l.count_down(part_size);
                     });
 
@@ -91,15 +187,10 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
             }
             else
             {
-                for (std::size_t part_i = part_begin; part_i < part_end;
-                     ++part_i)
-                {
-                    results[part_i] =
-                        hpx::detail::async_launch_policy_dispatch<decltype(
-                            policy)>::call(policy, pool, priority, stacksize,
-                            hint, f, *it, ts...);
-                    ++it;
-                }
+                bulk_async_execute_part<func_result_type>(pool, priority,
+                    stacksize, hint, policy, desc, results, part_begin,
+                    part_end, f, it, ts...);
+                std::advance(it, part_size);
                 l.count_down(part_size);
             }
 
@@ -25,11 +25,10 @@
 #include <hpx/type_support/decay.hpp>
 #include <hpx/type_support/unused.hpp>
 
-#include <boost/container/small_vector.hpp>
-
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -61,6 +60,78 @@ namespace hpx { namespace lcos { namespace detail {
     template <typename Result>
     struct future_data;
 
+    ///////////////////////////////////////////////////////////////////////
+    // Continuations registered with a shared state are kept in an intrusive
+    // singly-linked list of these nodes.
+    struct completed_callback_node
+    {
+        typedef util::unique_function_nonser<void()> completed_callback_type;
+
+        completed_callback_node() noexcept
+          : next_(nullptr)
+        {
+        }
+
+        explicit completed_callback_node(completed_callback_type&& f) noexcept
+          : f_(std::move(f))
+          , next_(nullptr)
+        {
+        }
+
+        completed_callback_type f_;
+        completed_callback_node* next_;
+    };
+
+    // The continuations which were registered with a shared state by the
+    // time it became ready, in the order of their registration. The first
+    // continuation is stored in place, all others are owned by the list.
+    class HPX_PARALLELISM_EXPORT completed_callback_list
+    {
+    public:
+        typedef completed_callback_node::completed_callback_type
+            completed_callback_type;
+
+        completed_callback_list() noexcept
+          : head_(nullptr)
+        {
+        }
+
+        completed_callback_list(completed_callback_list&& rhs) noexcept
+          : first_(std::move(rhs.first_))
+          , head_(rhs.head_)
+        {
+            rhs.head_ = nullptr;
+        }
+
+        completed_callback_list& operator=(
+            completed_callback_list&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                clear();
+                first_ = std::move(rhs.first_);
+                head_ = rhs.head_;
+                rhs.head_ = nullptr;
+            }
+            return *this;
+        }
+
+        ~completed_callback_list()
+        {
+            clear();
+        }
+
+        bool empty() const noexcept
+        {
+            return !first_ && head_ == nullptr;
+        }
+
+        void clear() noexcept;
+
+        completed_callback_type first_;
+        completed_callback_node* head_;
+    };
+
     ///////////////////////////////////////////////////////////////////////
     struct future_data_refcnt_base;
 
@@ -72,8 +143,7 @@ namespace hpx { namespace lcos { namespace detail {
     {
     public:
         typedef util::unique_function_nonser<void()> completed_callback_type;
-        typedef boost::container::small_vector<completed_callback_type, 1>
-            completed_callback_vector_type;
+        typedef completed_callback_list completed_callback_list_type;
 
         typedef void has_future_data_refcnt_base;
 
@@ -199,17 +269,21 @@ namespace hpx { namespace lcos { namespace detail {
     {
         future_data_base()
           : state_(empty)
+          , on_completed_(nullptr)
+          , first_on_completed_used_(false)
         {
         }
 
         future_data_base(init_no_addref no_addref)
           : future_data_refcnt_base(no_addref)
           , state_(empty)
+          , on_completed_(nullptr)
+          , first_on_completed_used_(false)
         {
         }
 
+        using future_data_refcnt_base::completed_callback_list_type;
         using future_data_refcnt_base::completed_callback_type;
-        using future_data_refcnt_base::completed_callback_vector_type;
         typedef lcos::local::spinlock mutex_type;
         typedef util::unused_type result_type;
         typedef future_data_refcnt_base::init_no_addref init_no_addref;
@@ -267,7 +341,7 @@ namespace hpx { namespace lcos { namespace detail {
         static void run_on_completed(
             completed_callback_type&& on_completed) noexcept;
         static void run_on_completed(
-            completed_callback_vector_type&& on_completed) noexcept;
+            completed_callback_list_type&& on_completed) noexcept;
 
         // make sure continuation invocation does not recurse deeper than
         // allowed
@@ -302,10 +376,38 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     protected:
+        // Take all continuations registered so far. No continuations can be
+        // registered after this (they are invoked right away instead), this
+        // must be called once the state has been made ready.
+        completed_callback_list_type take_on_completed() noexcept;
+
+        // Drop all registered continuations without invoking them and allow
+        // to register new ones.
+        void reset_on_completed() noexcept;
+
+        // Wake up all threads waiting for this future to become ready.
+        void notify_waiting_threads();
+
         mutable mutex_type mtx_;
         std::atomic<state> state_;    // current state
-        completed_callback_vector_type on_completed_;
         local::detail::condition_variable cond_;    // threads waiting in read
+
+    private:
+        // Marks the list of continuations as closed once they have been
+        // taken by take_on_completed.
+        static completed_callback_node* on_completed_closed() noexcept
+        {
+            return reinterpret_cast<completed_callback_node*>(
+                static_cast<std::uintptr_t>(1));
+        }
+
+        // Registered continuations form a lock-free stack (most recently
+        // registered first). The node for the first continuation is kept in
+        // place to avoid allocating in the common case of a single
+        // continuation.
+        std::atomic<completed_callback_node*> on_completed_;
+        completed_callback_node first_on_completed_;
+        std::atomic<bool> first_on_completed_used_;
     };
 
     struct in_place
@@ -338,8 +440,8 @@ namespace hpx { namespace lcos { namespace detail {
         typedef typename base_type::init_no_addref init_no_addref;
         typedef
             typename base_type::completed_callback_type completed_callback_type;
-        typedef typename base_type::completed_callback_vector_type
-            completed_callback_vector_type;
+        typedef typename base_type::completed_callback_list_type
+            completed_callback_list_type;
 
         future_data_base() = default;
 
@@ -421,14 +523,6 @@ namespace hpx { namespace lcos { namespace detail {
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, std::forward<Ts>(ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
             state expected = empty;
@@ -437,28 +531,18 @@ namespace hpx { namespace lcos { namespace detail {
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_value",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(std::move(l), threads::thread_priority_boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
+            // take all continuations registered so far, any continuation
+            // registered from now on will be invoked directly
+            auto on_completed = take_on_completed();
 
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
+            // handle all threads waiting for the future to become ready
+            notify_waiting_threads();
 
             // invoke the callback (continuation) function
             if (!on_completed.empty())
@@ -478,14 +562,6 @@ namespace hpx { namespace lcos { namespace detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*) exception_ptr) std::exception_ptr(std::move(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'exception' at this
             // point signals to all other threads that this future is ready.
             state expected = empty;
@@ -494,28 +570,18 @@ namespace hpx { namespace lcos { namespace detail {
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_exception",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(std::move(l), threads::thread_priority_boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
+            // take all continuations registered so far, any continuation
+            // registered from now on will be invoked directly
+            auto on_completed = take_on_completed();
 
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
+            // handle all threads waiting for the future to become ready
+            notify_waiting_threads();
 
             // invoke the callback (continuation) function
             if (!on_completed.empty())
@@ -632,7 +698,7 @@ namespace hpx { namespace lcos { namespace detail {
                 break;
             }
 
-            on_completed_.clear();
+            this->reset_on_completed();
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -643,7 +709,6 @@ namespace hpx { namespace lcos { namespace detail {
 
     protected:
         using base_type::mtx_;
-        using base_type::on_completed_;
         using base_type::state_;
 
     private:
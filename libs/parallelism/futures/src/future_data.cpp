@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <utility>
 
@@ -33,6 +34,18 @@ namespace hpx { namespace lcos { namespace detail {
         run_on_completed_error_handler = f;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void completed_callback_list::clear() noexcept
+    {
+        first_.reset();
+        while (head_ != nullptr)
+        {
+            completed_callback_node* next = head_->next_;
+            delete head_;
+            head_ = next;
+        }
+    }
+
     future_data_refcnt_base::~future_data_refcnt_base() = default;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -79,7 +92,10 @@ namespace hpx { namespace lcos { namespace detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    future_data_base<traits::detail::future_data_void>::~future_data_base() {}
+    future_data_base<traits::detail::future_data_void>::~future_data_base()
+    {
+        reset_on_completed();
+    }
 
     static util::unused_type unused_;
 
@@ -167,11 +183,18 @@ namespace hpx { namespace lcos { namespace detail {
     }
 
     void future_data_base<traits::detail::future_data_void>::run_on_completed(
-        completed_callback_vector_type&& on_completed) noexcept
+        completed_callback_list_type&& on_completed) noexcept
     {
-        for (auto&& func : on_completed)
+        if (on_completed.first_)
+        {
+            run_on_completed(std::move(on_completed.first_));
+        }
+
+        while (on_completed.head_ != nullptr)
         {
-            run_on_completed(std::move(func));
+            std::unique_ptr<completed_callback_node> node(on_completed.head_);
+            on_completed.head_ = node->next_;
+            run_on_completed(std::move(node->f_));
         }
     }
 
@@ -227,12 +250,12 @@ namespace hpx { namespace lcos { namespace detail {
 
     // We need only one explicit instantiation here as the second version
     // (single callback) is implicitly instantiated below.
-    using completed_callback_vector_type =
-        future_data_refcnt_base::completed_callback_vector_type;
+    using completed_callback_list_type =
+        future_data_refcnt_base::completed_callback_list_type;
 
     template HPX_PARALLELISM_EXPORT void
     future_data_base<traits::detail::future_data_void>::handle_on_completed<
-        completed_callback_vector_type>(completed_callback_vector_type&&);
+        completed_callback_list_type>(completed_callback_list_type&&);
 
     /// Set the callback which needs to be invoked when the future becomes
     /// ready. If the future is ready the function will be invoked
@@ -243,26 +266,118 @@ namespace hpx { namespace lcos { namespace detail {
         if (!data_sink)
             return;
 
-        if (is_ready())
+        if (!is_ready())
         {
-            // invoke the callback (continuation) function right away
-            handle_on_completed(std::move(data_sink));
+            // the first continuation is stored in place, all others are
+            // allocated
+            completed_callback_node* node = nullptr;
+            if (!first_on_completed_used_.exchange(
+                    true, std::memory_order_relaxed))
+            {
+                node = &first_on_completed_;
+                node->f_ = std::move(data_sink);
+            }
+            else
+            {
+                node = new completed_callback_node(std::move(data_sink));
+            }
+
+            // push the continuation unless the continuations have been taken
+            // by now (the future became ready concurrently)
+            completed_callback_node* head =
+                on_completed_.load(std::memory_order_acquire);
+            while (head != on_completed_closed())
+            {
+                node->next_ = head;
+                if (on_completed_.compare_exchange_weak(head, node,
+                        std::memory_order_release, std::memory_order_acquire))
+                {
+                    return;
+                }
+            }
+
+            data_sink = std::move(node->f_);
+            if (node != &first_on_completed_)
+                delete node;
         }
-        else
+
+        // invoke the callback (continuation) function right away
+        handle_on_completed(std::move(data_sink));
+    }
+
+    future_data_base<traits::detail::future_data_void>::
+        completed_callback_list_type
+        future_data_base<traits::detail::future_data_void>::take_on_completed()
+            noexcept
+    {
+        completed_callback_node* head = on_completed_.exchange(
+            on_completed_closed(), std::memory_order_acq_rel);
+        HPX_ASSERT(head != on_completed_closed());
+
+        // Reverse the stack to invoke the continuations in the order they
+        // were registered. The in-place continuation is moved out as the
+        // continuations may release the last reference to this shared state.
+        completed_callback_list_type on_completed;
+        while (head != nullptr)
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            if (is_ready())
+            completed_callback_node* next = head->next_;
+            if (head == &first_on_completed_)
             {
-                l.unlock();
-
-                // invoke the callback (continuation) function
-                handle_on_completed(std::move(data_sink));
+                on_completed.first_ = std::move(head->f_);
+                head->next_ = nullptr;
             }
             else
             {
-                on_completed_.push_back(std::move(data_sink));
+                head->next_ = on_completed.head_;
+                on_completed.head_ = head;
             }
+            head = next;
         }
+        return on_completed;
+    }
+
+    void future_data_base<traits::detail::future_data_void>::
+        reset_on_completed() noexcept
+    {
+        // no synchronization is required as semantics guarantee a single
+        // writer and no reader
+        completed_callback_node* head =
+            on_completed_.exchange(nullptr, std::memory_order_relaxed);
+        if (head != on_completed_closed())
+        {
+            while (head != nullptr)
+            {
+                completed_callback_node* next = head->next_;
+                if (head != &first_on_completed_)
+                    delete head;
+                head = next;
+            }
+        }
+
+        first_on_completed_.f_.reset();
+        first_on_completed_.next_ = nullptr;
+        first_on_completed_used_.store(false, std::memory_order_relaxed);
+    }
+
+    void future_data_base<
+        traits::detail::future_data_void>::notify_waiting_threads()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        // Note: we use notify_one repeatedly instead of notify_all as we
+        //       know: a) that most of the time we have at most one thread
+        //       waiting on the future (most futures are not shared), and
+        //       b) our implementation of condition_variable::notify_one
+        //       relinquishes the lock before resuming the waiting thread
+        //       which avoids suspension of this thread when it tries to
+        //       re-lock the mutex while exiting from condition_variable::wait
+        while (cond_.notify_one(std::move(l), threads::thread_priority_boost))
+        {
+            l = std::unique_lock<mutex_type>(mtx_);
+        }
+
+        // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+        //       it unlocked when returning.
     }
 
     future_data_base<traits::detail::future_data_void>::state
@@ -0,0 +1,182 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/runtime/parcelset/detail/pending_parcels_queue.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    pending_parcels_queue::pending_parcels_queue(locality const& dest)
+      : dest_(dest)
+      , head_(&stub_)
+      , tail_(&stub_)
+      , size_(0)
+      , consumer_busy_(false)
+      , pending_(false)
+      , enqueued_(0)
+      , dequeued_(0)
+      , contentions_(0)
+    {
+    }
+
+    pending_parcels_queue::~pending_parcels_queue()
+    {
+        while (node* n = pop_node())
+        {
+            delete n;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void pending_parcels_queue::push_chain(node* first, node* last)
+    {
+        HPX_ASSERT(last->next_.load(std::memory_order_relaxed) == nullptr);
+
+        // the exchange serializes all producers, the store makes the chain
+        // visible to the consumer
+        node* prev = head_.exchange(last, std::memory_order_acq_rel);
+        prev->next_.store(first, std::memory_order_release);
+    }
+
+    void pending_parcels_queue::push(parcel&& p, write_handler_type&& f)
+    {
+        node* n = new node(std::move(p), std::move(f));
+
+        // account for the parcel before it becomes visible, this guarantees
+        // the size to never underflow
+        ++size_;
+        ++enqueued_;
+
+        push_chain(n, n);
+    }
+
+    void pending_parcels_queue::push(std::vector<parcel>&& parcels,
+        std::vector<write_handler_type>&& handlers)
+    {
+        HPX_ASSERT(parcels.size() == handlers.size());
+        if (parcels.empty())
+            return;
+
+        // link all new nodes locally, this allows to publish all of them
+        // using a single atomic exchange
+        node* first = nullptr;
+        node* last = nullptr;
+        for (std::size_t i = 0; i != parcels.size(); ++i)
+        {
+            node* n = new node(std::move(parcels[i]), std::move(handlers[i]));
+            if (last == nullptr)
+                first = n;
+            else
+                last->next_.store(n, std::memory_order_relaxed);
+            last = n;
+        }
+
+        size_ += parcels.size();
+        enqueued_ += static_cast<std::int64_t>(parcels.size());
+
+        push_chain(first, last);
+
+        parcels.clear();
+        handlers.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    pending_parcels_queue::node* pending_parcels_queue::pop_node()
+    {
+        node* tail = tail_;
+        node* next = tail->next_.load(std::memory_order_acquire);
+
+        if (tail == &stub_)
+        {
+            if (next == nullptr)
+                return nullptr;
+
+            tail_ = next;
+            tail = next;
+            next = next->next_.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr)
+        {
+            tail_ = next;
+            return tail;
+        }
+
+        // a producer has swapped the head but has not linked its nodes yet,
+        // those will be picked up by the next consumer
+        if (tail != head_.load(std::memory_order_acquire))
+            return nullptr;
+
+        // the last node can be removed only after the stub node has been
+        // re-inserted behind it
+        stub_.next_.store(nullptr, std::memory_order_relaxed);
+        push_chain(&stub_, &stub_);
+
+        next = tail->next_.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            tail_ = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+    std::size_t pending_parcels_queue::pop_all(std::vector<parcel>& parcels,
+        std::vector<write_handler_type>& handlers)
+    {
+        HPX_ASSERT(consumer_busy_.load(std::memory_order_relaxed));
+        HPX_ASSERT(parcels.size() == handlers.size());
+
+        std::size_t count = 0;
+        parcels.reserve(parcels.size() + size());
+        handlers.reserve(handlers.size() + size());
+
+        while (node* n = pop_node())
+        {
+            parcels.push_back(std::move(n->parcel_));
+            handlers.push_back(std::move(n->handler_));
+            delete n;
+            ++count;
+        }
+
+        if (count != 0)
+        {
+            HPX_ASSERT(size_.load(std::memory_order_relaxed) >= count);
+            size_ -= count;
+            dequeued_ += static_cast<std::int64_t>(count);
+        }
+        return count;
+    }
+
+    bool pending_parcels_queue::pop(parcel& p, write_handler_type& f)
+    {
+        HPX_ASSERT(consumer_busy_.load(std::memory_order_relaxed));
+
+        node* n = pop_node();
+        if (n == nullptr)
+            return false;
+
+        p = std::move(n->parcel_);
+        f = std::move(n->handler_);
+        delete n;
+
+        --size_;
+        ++dequeued_;
+        return true;
+    }
+}}}
+
+#endif
@@ -991,6 +991,16 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // statistics of the queues of pending parcels
+    std::int64_t parcelhandler::get_pending_parcels_statistics(
+        std::string const& pp_type,
+        parcelport::pending_parcels_statistics_type stat_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_pending_parcels_statistics(stat_type, reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
     // number of parcels sent
@@ -1058,6 +1068,7 @@ namespace hpx { namespace parcelset
         {
             register_counter_types(pp.second->type());
             register_connection_cache_counter_types(pp.second->type());
+            register_pending_parcels_counter_types(pp.second->type());
         }
 
         using util::placeholders::_1;
@@ -1531,6 +1542,77 @@ namespace hpx { namespace parcelset
 #endif
     }
 
+    // register connection specific performance counters related to the
+    // queues of parcels pending to be sent
+    void parcelhandler::register_pending_parcels_counter_types(
+        std::string const& pp_type)
+    {
+#if defined(HPX_HAVE_NETWORKING)
+        if (!is_networking_enabled_)
+            return;
+
+        using hpx::util::placeholders::_1;
+        using hpx::util::placeholders::_2;
+
+        util::function_nonser<std::int64_t(bool)> enqueued(
+            util::bind_front(&parcelhandler::get_pending_parcels_statistics,
+                this, pp_type, parcelport::pending_parcels_enqueued));
+        util::function_nonser<std::int64_t(bool)> dequeued(
+            util::bind_front(&parcelhandler::get_pending_parcels_statistics,
+                this, pp_type, parcelport::pending_parcels_dequeued));
+        util::function_nonser<std::int64_t(bool)> contentions(
+            util::bind_front(&parcelhandler::get_pending_parcels_statistics,
+                this, pp_type, parcelport::pending_parcels_contentions));
+
+        performance_counters::generic_counter_type_data const
+            pending_parcels_types[] =
+        {
+            { hpx::util::format(
+                  "/parcelport/count/{}/enqueued", pp_type),
+              performance_counters::counter_monotonically_increasing,
+              hpx::util::format(
+                  "returns the number of parcels which were added to the "
+                  "queues of pending parcels for the {} connection type on "
+                  "the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(enqueued), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/dequeued", pp_type),
+              performance_counters::counter_monotonically_increasing,
+              hpx::util::format(
+                  "returns the number of parcels which were taken from the "
+                  "queues of pending parcels for the {} connection type on "
+                  "the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(dequeued), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/queue-contentions", pp_type),
+              performance_counters::counter_monotonically_increasing,
+              hpx::util::format(
+                  "returns the number of times a thread could not dequeue "
+                  "pending parcels for the {} connection type on the "
+                  "referenced locality as another thread was dequeuing "
+                  "parcels for the same destination", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(contentions), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            }
+        };
+        performance_counters::install_counter_types(pending_parcels_types,
+            sizeof(pending_parcels_types)/sizeof(pending_parcels_types[0]));
+#endif
+    }
+
     std::vector<plugins::parcelport_factory_base *> &
     parcelhandler::get_parcelport_factories()
     {
@@ -23,11 +23,15 @@
 #endif
 #include <hpx/assert.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace parcelset
 {
@@ -35,6 +39,8 @@ namespace hpx { namespace parcelset
     parcelport::parcelport(util::runtime_configuration const& ini,
             locality const & here, std::string const& type)
       : applier_(nullptr),
+        pending_parcels_queues_(nullptr),
+        parcel_destinations_(64),
         num_parcel_destinations_(0),
         here_(here),
         max_inbound_message_size_(ini.get_max_inbound_message_size()),
@@ -69,6 +75,115 @@ namespace hpx { namespace parcelset
         {
             async_serialization_ = true;
         }
+
+        pending_parcels_queues_storage_.emplace_back(
+            new pending_parcels_queues);
+        pending_parcels_queues_.store(
+            pending_parcels_queues_storage_.back().get());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        struct pending_parcels_queue_less
+        {
+            bool operator()(
+                pending_parcels_queue const* q, locality const& l) const
+            {
+                return q->destination() < l;
+            }
+        };
+    }
+
+    detail::pending_parcels_queue* parcelport::find_pending_parcels_queue(
+        locality const& dest) const
+    {
+        pending_parcels_queues const& queues =
+            *pending_parcels_queues_.load(std::memory_order_acquire);
+
+        auto it = std::lower_bound(queues.begin(), queues.end(), dest,
+            detail::pending_parcels_queue_less());
+        if (it != queues.end() && (*it)->destination() == dest)
+            return *it;
+
+        return nullptr;
+    }
+
+    detail::pending_parcels_queue& parcelport::get_pending_parcels_queue(
+        locality const& dest)
+    {
+        detail::pending_parcels_queue* q = find_pending_parcels_queue(dest);
+        if (q != nullptr)
+            return *q;
+
+        std::lock_guard<lcos::local::spinlock> l(mtx_);
+
+        // the queue could have been created concurrently
+        pending_parcels_queues const& queues =
+            *pending_parcels_queues_.load(std::memory_order_relaxed);
+
+        auto it = std::lower_bound(queues.begin(), queues.end(), dest,
+            detail::pending_parcels_queue_less());
+        if (it != queues.end() && (*it)->destination() == dest)
+            return **it;
+
+        pending_parcels_storage_.emplace_back(
+            new detail::pending_parcels_queue(dest));
+        q = pending_parcels_storage_.back().get();
+
+        // publish a new array of queues, the old one stays valid as it might
+        // be referenced by concurrent lookups
+        std::unique_ptr<pending_parcels_queues> new_queues(
+            new pending_parcels_queues);
+        new_queues->reserve(queues.size() + 1);
+        new_queues->insert(new_queues->end(), queues.begin(), it);
+        new_queues->push_back(q);
+        new_queues->insert(new_queues->end(), it, queues.end());
+
+        pending_parcels_queues_.store(
+            new_queues.get(), std::memory_order_release);
+        pending_parcels_queues_storage_.push_back(std::move(new_queues));
+
+        return *q;
+    }
+
+    void parcelport::add_pending_parcels_destination(
+        detail::pending_parcels_queue& q)
+    {
+        if (q.mark_pending())
+        {
+            ++num_parcel_destinations_;
+            parcel_destinations_.push(&q);
+        }
+    }
+
+    void parcelport::get_pending_parcels_destinations(
+        std::vector<locality>& destinations)
+    {
+        std::vector<detail::pending_parcels_queue*> still_pending;
+
+        detail::pending_parcels_queue* q = nullptr;
+        while (parcel_destinations_.pop(q))
+        {
+            // The queue is removed from the set before checking whether it is
+            // empty, parcels enqueued concurrently will add it back.
+            q->clear_pending();
+            if (!q->empty() && q->mark_pending())
+            {
+                still_pending.push_back(q);
+                destinations.push_back(q->destination());
+            }
+            else
+            {
+                HPX_ASSERT(0 != num_parcel_destinations_.load());
+                --num_parcel_destinations_;
+            }
+        }
+
+        for (detail::pending_parcels_queue* q : still_pending)
+        {
+            parcel_destinations_.push(q);
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -188,18 +303,45 @@ namespace hpx { namespace parcelset
 
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
-        std::lock_guard<lcos::local::spinlock> l(mtx_);
         std::int64_t count = 0;
-        for (auto && p : pending_parcels_)
+        for (detail::pending_parcels_queue* q :
+            *pending_parcels_queues_.load(std::memory_order_acquire))
         {
-            count += hpx::get<0>(p.second).size();
-            HPX_ASSERT(
-                hpx::get<0>(p.second).size() ==
-                hpx::get<1>(p.second).size());
+            count += q->size();
         }
         return count;
     }
 
+    std::int64_t parcelport::get_pending_parcels_statistics(
+        pending_parcels_statistics_type stat_type, bool reset)
+    {
+        std::int64_t result = 0;
+        for (detail::pending_parcels_queue* q :
+            *pending_parcels_queues_.load(std::memory_order_acquire))
+        {
+            switch (stat_type)
+            {
+            case pending_parcels_enqueued:
+                result += q->get_enqueued(reset);
+                break;
+
+            case pending_parcels_dequeued:
+                result += q->get_dequeued(reset);
+                break;
+
+            case pending_parcels_contentions:
+                result += q->get_contentions(reset);
+                break;
+
+            default:
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "parcelport::get_pending_parcels_statistics",
+                    "invalid statistics type");
+            }
+        }
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
@@ -20,6 +20,11 @@
 #include <hpx/modules/threadmanager.hpp>
 #include <hpx/runtime/threads/threadmanager_counters.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
+#include <hpx/threading_base/stack_size_tracking.hpp>
+
+#if !defined(HPX_WINDOWS) && defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
 
 #include <cstddef>
 #include <cstdint>
@@ -414,6 +419,16 @@ namespace hpx { namespace threads {
             return naming::invalid_gid;
         }
 #endif
+
+        ///////////////////////////////////////////////////////////////////////////
+        // creation function for counters exposed by a free function
+        naming::gid_type locality_function_counter_creator(
+            std::int64_t (*f)(bool),
+            performance_counters::counter_info const& info, error_code& ec)
+        {
+            return performance_counters::locality_raw_counter_creator(
+                info, f, ec);
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -705,6 +720,46 @@ namespace hpx { namespace threads {
                     &thread_pool_base::get_thread_count_staged),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 ""},
+#if !defined(HPX_WINDOWS) && defined(HPX_HAVE_THREAD_STACK_MMAP)
+            {   "/threads/count/stack-pool-hits",
+                performance_counters::counter_monotonically_increasing,
+                "returns the total number of HPX-thread stacks which were "
+                "taken from the process-wide stack cache (hpx.stacks.pool_size) "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_function_counter_creator,
+                    &threads::coroutines::detail::posix::
+                        get_stack_pool_hit_count),
+                &performance_counters::locality_counter_discoverer, ""},
+            {   "/threads/count/stack-pool-misses",
+                performance_counters::counter_monotonically_increasing,
+                "returns the total number of HPX-thread stacks which could not "
+                "be taken from the process-wide stack cache "
+                "(hpx.stacks.pool_size) for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_function_counter_creator,
+                    &threads::coroutines::detail::posix::
+                        get_stack_pool_miss_count),
+                &performance_counters::locality_counter_discoverer, ""},
+#endif
+            {   "/threads/count/stack-promotions",
+                performance_counters::counter_monotonically_increasing,
+                "returns the total number of HPX-threads which were created "
+                "with a larger stack size than requested "
+                "(hpx.stacks.auto_size) for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_function_counter_creator,
+                    &threads::get_stack_size_promotion_count),
+                &performance_counters::locality_counter_discoverer, ""},
+            {   "/threads/count/stack-demotions",
+                performance_counters::counter_monotonically_increasing,
+                "returns the total number of HPX-threads which were created "
+                "with a smaller stack size than requested "
+                "(hpx.stacks.auto_size) for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_function_counter_creator,
+                    &threads::get_stack_size_demotion_count),
+                &performance_counters::locality_counter_discoverer, ""},
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
             {   "/threads/count/stack-recycles",
                 performance_counters::counter_monotonically_increasing,
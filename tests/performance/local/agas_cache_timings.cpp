@@ -14,8 +14,10 @@
 
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
 #include <hpx/statistics/histogram.hpp>
 #include <hpx/modules/testing.hpp>
 
@@ -28,6 +30,7 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -229,6 +232,147 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Measure the throughput of concurrent lookups, comparing the LRU cache
+// protected by a single lock (as used by AGAS before) with the sharded AGAS
+// cache.
+struct locked_cache
+{
+    typedef hpx::util::cache::lru_cache<hpx::agas::detail::gva_cache_key,
+        hpx::agas::gva, hpx::util::cache::statistics::local_full_statistics>
+        cache_type;
+
+    explicit locked_cache(std::size_t cache_size)
+      : cache_(cache_size)
+    {
+    }
+
+    void insert(gva_cache_key const& key, hpx::agas::gva const& value)
+    {
+        hpx::agas::detail::gva_cache_key k(key.get_gid(), 1);
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        cache_.insert(k, value);
+    }
+
+    bool get_entry(gva_cache_key const& key)
+    {
+        hpx::agas::detail::gva_cache_key k(key.get_gid(), 1);
+        hpx::agas::detail::gva_cache_key idbase;
+        cache_type::entry_type e;
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        return cache_.get_entry(k, idbase, e);
+    }
+
+    hpx::lcos::local::spinlock mtx_;
+    cache_type cache_;
+};
+
+struct sharded_cache
+{
+    sharded_cache(std::size_t cache_size, std::size_t num_shards)
+      : cache_(num_shards)
+    {
+        cache_.reserve(cache_size);
+    }
+
+    void insert(gva_cache_key const& key, hpx::agas::gva const& value)
+    {
+        hpx::agas::detail::gva_cache_key k(key.get_gid(), 1);
+        cache_.update_if(k, value,
+            [](hpx::agas::detail::gva_cache_key const&,
+                hpx::agas::detail::gva_cache_key const&) { return false; });
+    }
+
+    bool get_entry(gva_cache_key const& key)
+    {
+        hpx::agas::detail::gva_cache_key k(key.get_gid(), 1);
+        hpx::agas::detail::gva_cache_key idbase;
+        hpx::agas::detail::gva_cache::entry_type e;
+
+        return cache_.get_entry(k, idbase, e);
+    }
+
+    hpx::agas::detail::gva_cache cache_;
+};
+
+template <typename Cache>
+double test_concurrent_get(Cache& cache, hpx::naming::gid_type first_key,
+    std::size_t num_entries, std::size_t num_tasks, std::size_t num_lookups)
+{
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([&, i]() {
+            // every task walks the entries starting at a different offset
+            std::size_t index = (i * num_entries) / num_tasks;
+            for (std::size_t j = 0; j != num_lookups; ++j)
+            {
+                hpx::naming::gid_type key = first_key;
+                key += std::uint64_t(index + 1);
+                cache.get_entry(gva_cache_key(key, 1));
+
+                if (++index == num_entries)
+                    index = 0;
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    return double(num_tasks * num_lookups) / t.elapsed();
+}
+
+template <typename Cache>
+void fill_cache(Cache& cache, hpx::naming::gid_type first_key,
+    std::size_t num_entries)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::uint32_t ct = hpx::components::component_invalid;
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::naming::gid_type key = first_key;
+        key += std::uint64_t(i + 1);
+        cache.insert(gva_cache_key(key, 1),
+            hpx::agas::gva(locality, ct, 1, std::uint64_t(0), 0));
+    }
+}
+
+void test_scaling(std::size_t cache_size, std::size_t num_entries,
+    std::size_t num_shards, std::size_t num_lookups)
+{
+    hpx::naming::gid_type first_key = hpx::detail::get_next_id();
+
+    locked_cache locked(cache_size);
+    fill_cache(locked, first_key, num_entries);
+
+    sharded_cache sharded(cache_size, num_shards);
+    fill_cache(sharded, first_key, num_entries);
+
+    std::cout << "concurrent get (lookups/s), shards: "
+              << sharded.cache_.num_shards() << std::endl;
+
+    std::size_t num_threads = hpx::get_os_thread_count();
+    for (std::size_t num_tasks = 1; num_tasks <= num_threads; num_tasks *= 2)
+    {
+        double locked_rate = test_concurrent_get(
+            locked, first_key, num_entries, num_tasks, num_lookups);
+        double sharded_rate = test_concurrent_get(
+            sharded, first_key, num_entries, num_tasks, num_lookups);
+
+        std::cout << "tasks: " << std::setw(4) << num_tasks
+                  << ", single lock: " << std::setw(12) << std::fixed
+                  << std::setprecision(0) << locked_rate
+                  << ", sharded: " << std::setw(12) << sharded_rate
+                  << std::endl;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -240,6 +384,14 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
+    std::size_t num_shards = HPX_AGAS_LOCAL_CACHE_SHARDS;
+    if (vm.count("shards"))
+        num_shards = vm["shards"].as<std::size_t>();
+
+    std::size_t num_lookups = 100000;
+    if (vm.count("lookups"))
+        num_lookups = vm["lookups"].as<std::size_t>();
+
     gva_cache_type cache;
     cache.reserve(cache_size);
 
@@ -254,6 +406,9 @@ int hpx_main(hpx::program_options::variables_map& vm)
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
+    test_scaling(cache_size, (std::min)(num_entries, cache_size), num_shards,
+        num_lookups);
+
     return hpx::finalize();
 }
 
@@ -269,6 +424,11 @@ int main(int argc, char* argv[])
          HPX_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")
         ("num_entries,n", value<std::size_t>(),
          "number of items to insert into cache (default: 1000)")
+        ("shards", value<std::size_t>(),
+         "number of shards of the sharded cache (default: "
+         HPX_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SHARDS) ")")
+        ("lookups", value<std::size_t>(),
+         "number of concurrent lookups per task (default: 100000)")
         ;
 
     // Initialize and run HPX
@@ -0,0 +1,251 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the sequential, parallel, vectorized sequential,
+// and vectorized parallel execution of the algorithms which have SIMD kernels
+// for the datapar execution policies.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_adjacent_find.hpp>
+#include <hpx/include/parallel_count.hpp>
+#include <hpx/include/parallel_equal.hpp>
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/parallel_find.hpp>
+#include <hpx/include/parallel_minmax.hpp>
+#include <hpx/include/parallel_mismatch.hpp>
+#include <hpx/include/parallel_replace.hpp>
+#include <hpx/include/parallel_scan.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct equal_to
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 == t2)
+    {
+        return t1 == t2;
+    }
+};
+
+struct less
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 < t2)
+    {
+        return t1 < t2;
+    }
+};
+
+struct plus
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 + t2)
+    {
+        return t1 + t2;
+    }
+};
+
+struct is_negative
+{
+    template <typename T>
+    auto operator()(T const& t) const -> decltype(t < 0)
+    {
+        return t < 0;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct benchmark_data
+{
+    explicit benchmark_data(std::size_t size)
+      : data1(size)
+      , data2(size)
+      , dest(size)
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        // the sequences are strictly increasing, identical, and do not
+        // contain the values searched for: all algorithms will have to
+        // inspect the full input
+        std::iota(std::begin(data1), std::end(data1), 0.0f);
+        std::iota(std::begin(data2), std::end(data2), 0.0f);
+    }
+
+    std::vector<float> data1;
+    std::vector<float> data2;
+    std::vector<float> dest;
+};
+
+template <typename ExPolicy>
+void run_algorithm(std::string const& name, ExPolicy&& policy,
+    benchmark_data& d)
+{
+    if (name == "find")
+    {
+        hpx::find(policy, std::begin(d.data1), std::end(d.data1), -1.0f);
+    }
+    else if (name == "mismatch")
+    {
+        hpx::mismatch(policy, std::begin(d.data1), std::end(d.data1),
+            std::begin(d.data2), ::equal_to());
+    }
+    else if (name == "equal")
+    {
+        hpx::equal(policy, std::begin(d.data1), std::end(d.data1),
+            std::begin(d.data2), ::equal_to());
+    }
+    else if (name == "minmax_element")
+    {
+        hpx::parallel::minmax_element(
+            policy, std::begin(d.data1), std::end(d.data1), ::less());
+    }
+    else if (name == "count_if")
+    {
+        hpx::count_if(
+            policy, std::begin(d.data1), std::end(d.data1), ::is_negative());
+    }
+    else if (name == "adjacent_find")
+    {
+        hpx::parallel::adjacent_find(
+            policy, std::begin(d.data1), std::end(d.data1), ::equal_to());
+    }
+    else if (name == "replace")
+    {
+        hpx::parallel::replace(
+            policy, std::begin(d.dest), std::end(d.dest), -1.0f, 1.0f);
+    }
+    else if (name == "fill")
+    {
+        hpx::fill(policy, std::begin(d.dest), std::end(d.dest), 1.0f);
+    }
+    else if (name == "inclusive_scan")
+    {
+        hpx::parallel::inclusive_scan(policy, std::begin(d.data1),
+            std::end(d.data1), std::begin(d.dest), ::plus());
+    }
+    else if (name == "exclusive_scan")
+    {
+        hpx::parallel::exclusive_scan(policy, std::begin(d.data1),
+            std::end(d.data1), std::begin(d.dest), 0.0f, ::plus());
+    }
+}
+
+template <typename ExPolicy>
+double measure(std::string const& name, ExPolicy&& policy, benchmark_data& d,
+    int test_count)
+{
+    // warm up caches
+    run_algorithm(name, policy, d);
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+    for (int i = 0; i != test_count; ++i)
+    {
+        run_algorithm(name, policy, d);
+    }
+    return double(hpx::chrono::high_resolution_clock::now() - start) /
+        (1e9 * test_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t size = vm["vector_size"].as<std::size_t>();
+    bool csvoutput = vm["csv_output"].as<int>() ? true : false;
+    int test_count = vm["test_count"].as<int>();
+
+    std::vector<std::string> algorithms = {"find", "mismatch", "equal",
+        "minmax_element", "count_if", "adjacent_find", "replace", "fill",
+        "inclusive_scan", "exclusive_scan"};
+    if (vm.count("algorithm"))
+    {
+        algorithms = vm["algorithm"].as<std::vector<std::string>>();
+    }
+
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be less than zero...\n" << hpx::flush;
+        return hpx::finalize();
+    }
+
+    benchmark_data d(size);
+
+    if (csvoutput)
+    {
+        hpx::cout << "algorithm,seq,par,dataseq,datapar\n" << hpx::flush;
+    }
+
+    for (std::string const& name : algorithms)
+    {
+        double time_seq = measure(name, hpx::execution::seq, d, test_count);
+        double time_par = measure(name, hpx::execution::par, d, test_count);
+        double time_dataseq =
+            measure(name, hpx::execution::dataseq, d, test_count);
+        double time_datapar =
+            measure(name, hpx::execution::datapar, d, test_count);
+
+        if (csvoutput)
+        {
+            hpx::cout << name << "," << time_seq << "," << time_par << ","
+                      << time_dataseq << "," << time_datapar << "\n"
+                      << hpx::flush;
+        }
+        else
+        {
+            hpx::cout << std::left << std::setw(16) << name << std::right
+                      << " seq: " << std::setw(12) << time_seq
+                      << " par: " << std::setw(12) << time_par
+                      << " dataseq: " << std::setw(12) << time_dataseq
+                      << " (x" << std::setprecision(3)
+                      << time_seq / time_dataseq << ")"
+                      << " datapar: " << std::setw(12) << time_datapar
+                      << " (x" << time_par / time_datapar << ")\n"
+                      << std::setprecision(6) << hpx::flush;
+        }
+
+        d.reset();
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    using namespace hpx::program_options;
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(1048576),
+         "size of the input sequences (default: 1048576)")
+        ("csv_output", value<int>()->default_value(0),
+         "print results in csv format")
+        ("test_count", value<int>()->default_value(10),
+         "number of tests to take average from (default: 10)")
+        ("algorithm", value<std::vector<std::string>>()->composing(),
+         "algorithm(s) to measure (default: all), one of find, mismatch, "
+         "equal, minmax_element, count_if, adjacent_find, replace, fill, "
+         "inclusive_scan, exclusive_scan")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -69,6 +69,42 @@ namespace hpx { namespace parallel { namespace execution {
     };
 }}}    // namespace hpx::parallel::execution
 
+///////////////////////////////////////////////////////////////////////////////
+// An executor which hands each task to the scheduler separately instead of
+// submitting all tasks of a core as one batch. It serves as the baseline for
+// the batched task submission of the parallel_executor.
+struct unbatched_executor : hpx::execution::parallel_executor
+{
+    template <typename F, typename S, typename... Ts>
+    std::vector<hpx::future<typename hpx::parallel::execution::detail::
+            bulk_function_result<F, S, Ts...>::type>>
+    bulk_async_execute(F&& f, S const& shape, Ts&&... ts) const
+    {
+        std::vector<hpx::future<typename hpx::parallel::execution::detail::
+                bulk_function_result<F, S, Ts...>::type>>
+            results;
+        results.reserve(hpx::util::size(shape));
+
+        for (auto const& elem : shape)
+        {
+            results.push_back(this->async_execute(f, elem, ts...));
+        }
+        return results;
+    }
+};
+
+namespace hpx { namespace parallel { namespace execution {
+    template <>
+    struct is_two_way_executor<unbatched_executor> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_bulk_two_way_executor<unbatched_executor> : std::true_type
+    {
+    };
+}}}    // namespace hpx::parallel::execution
+
 ///////////////////////////////////////////////////////////////////////////////
 void measure_sequential_foreach(
     std::vector<std::size_t> const& data_representation)
@@ -434,6 +470,18 @@ int hpx_main(hpx::program_options::variables_map& vm)
             task_time_forloop = averageout_task_forloop(vector_size, par);
             seq_time_forloop = averageout_sequential_forloop(vector_size);
         }
+        else if (vm.count("unbatched") != 0)
+        {
+            unbatched_executor par;
+
+            par_time_foreach = averageout_parallel_foreach(vector_size, par);
+            task_time_foreach = averageout_task_foreach(vector_size, par);
+            seq_time_foreach = averageout_sequential_foreach(vector_size);
+
+            par_time_forloop = averageout_parallel_forloop(vector_size, par);
+            task_time_forloop = averageout_task_forloop(vector_size, par);
+            seq_time_forloop = averageout_sequential_forloop(vector_size);
+        }
         else
         {
             hpx::execution::parallel_executor par;
@@ -566,6 +614,10 @@ int main(int argc, char* argv[])
         ("aggregated"
         ,"use aggregated executor")
 
+        ("unbatched"
+        ,"submit the tasks of the parallel executor one by one instead of "
+         "as a batch")
+
         ("disable_stealing"
         ,"disable thread stealing")
 
@@ -22,6 +22,7 @@
 #include <hpx/include/parallel_for_loop.hpp>
 #include <hpx/include/threads.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/modules/futures.hpp>
 #include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/modules/timing.hpp>
@@ -478,6 +479,117 @@ void measure_function_futures_create_thread_hierarchical_placement(
         "create_thread_hierarchical", "latch", "none", count, duration, csv);
 }
 
+// Measure how the throughput of thread creation scales with the number of
+// cores concurrently creating threads. For each number of spawning cores
+// (1, 2, 4, ..., num_threads) every spawning core creates its share of
+// threads directly on its own queue.
+void measure_function_futures_create_thread_scaling(
+    std::uint64_t count, bool csv)
+{
+    auto const sched = hpx::threads::get_self_id_data()->get_scheduler_base();
+    auto const desc = hpx::util::thread_description();
+    auto const prio = hpx::threads::thread_priority_normal;
+    auto const stack_size = hpx::threads::thread_stacksize_small;
+    auto const num_threads = hpx::get_num_worker_threads();
+
+    for (std::size_t spawners = 1; spawners <= num_threads; spawners *= 2)
+    {
+        hpx::lcos::local::latch l(count);
+
+        auto const func = [&l]() {
+            null_function();
+            l.count_down(1);
+        };
+        auto const thread_func =
+            hpx::threads::detail::thread_function_nullary<decltype(func)>{func};
+
+        // start the clock
+        high_resolution_timer walltime;
+        for (std::size_t t = 0; t < spawners; ++t)
+        {
+            auto const hint = hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(t));
+            auto spawn_func = [&thread_func, sched, hint, t, count, spawners,
+                                  desc, prio]() {
+                std::uint64_t const count_start = t * count / spawners;
+                std::uint64_t const count_end = (t + 1) * count / spawners;
+                hpx::error_code ec;
+                for (std::uint64_t i = count_start; i < count_end; ++i)
+                {
+                    hpx::threads::thread_init_data init(
+                        hpx::threads::thread_function_type(thread_func), desc,
+                        prio, hint, stack_size, hpx::threads::pending, false,
+                        sched);
+                    sched->create_thread(init, nullptr, ec);
+                }
+            };
+            auto const thread_spawn_func = hpx::threads::detail::
+                thread_function_nullary<decltype(spawn_func)>{spawn_func};
+
+            hpx::error_code ec;
+            hpx::threads::thread_init_data init(
+                hpx::threads::thread_function_type(thread_spawn_func), desc,
+                prio, hint, stack_size, hpx::threads::pending, false, sched);
+            sched->create_thread(init, nullptr, ec);
+        }
+        l.wait();
+
+        // stop the clock
+        const double duration = walltime.elapsed();
+        std::string const spawners_str =
+            "spawners " + std::to_string(spawners);
+        print_stats("create_thread_scaling", "latch", spawners_str.c_str(),
+            count, duration, csv);
+    }
+}
+
+// Measure the overhead of attaching many continuations to a single future
+// concurrently from all cores and of invoking them once the future becomes
+// ready.
+void measure_function_futures_continuations(std::uint64_t count, bool csv)
+{
+    hpx::lcos::local::promise<void> p;
+    hpx::shared_future<void> f = p.get_future().share();
+
+    auto const num_threads = hpx::get_num_worker_threads();
+    hpx::lcos::local::latch attached(num_threads + 1);
+    hpx::lcos::local::latch l(count);
+
+    auto const func = [&l](hpx::shared_future<void> const&) {
+        null_function();
+        l.count_down(1);
+    };
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        auto const hint =
+            hpx::threads::thread_schedule_hint(static_cast<std::int16_t>(t));
+        auto attach_func = [&f, &func, &attached, t, count, num_threads]() {
+            std::uint64_t const count_start = t * count / num_threads;
+            std::uint64_t const count_end = (t + 1) * count / num_threads;
+
+            for (std::uint64_t i = count_start; i < count_end; ++i)
+            {
+                f.then(hpx::launch::sync, func);
+            }
+            attached.count_down(1);
+        };
+
+        auto exec = hpx::execution::parallel_executor(hint);
+        hpx::apply(exec, attach_func);
+    }
+    attached.count_down_and_wait();
+
+    p.set_value();
+    l.wait();
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("then", "latch", "shared_future", count, duration, csv);
+}
+
 void measure_function_futures_apply_hierarchical_placement(
     std::uint64_t count, bool csv)
 {
@@ -530,6 +642,7 @@ int hpx_main(variables_map& vm)
             numa_sensitive = 0;
 
         bool test_all = (vm.count("test-all") > 0);
+        bool test_scaling = (vm.count("scaling") > 0);
         const int repetitions = vm["repetitions"].as<int>();
 
         if (vm.count("info"))
@@ -552,6 +665,12 @@ int hpx_main(variables_map& vm)
 
         for (int i = 0; i < repetitions; i++)
         {
+            if (test_scaling)
+            {
+                measure_function_futures_create_thread_scaling(count, csv);
+                continue;
+            }
+
             measure_function_futures_limiting_executor(count, csv, par);
             measure_function_futures_create_thread_hierarchical_placement(
                 count, csv);
@@ -574,6 +693,7 @@ int hpx_main(variables_map& vm)
                 measure_function_futures_create_thread(count, csv);
                 measure_function_futures_apply_hierarchical_placement(
                     count, csv);
+                measure_function_futures_continuations(count, csv);
             }
         }
     }
@@ -597,6 +717,8 @@ int main(int argc, char* argv[])
 
         ("csv", "output results as csv (format: count,duration)")
         ("test-all", "run all benchmarks")
+        ("scaling", "only measure how the thread creation throughput scales "
+         "with the number of cores creating threads")
         ("repetitions", value<int>()->default_value(1),
          "number of repetitions of the full benchmark")
 
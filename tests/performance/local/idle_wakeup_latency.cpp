@@ -0,0 +1,137 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures how quickly idle worker threads pick up a burst of
+// work after a period without any work and how much CPU time they consume
+// while being idle. It compares the exponential idle back-off with the
+// adaptive idle parking of the schedulers.
+
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/synchronization/latch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+///////////////////////////////////////////////////////////////////////////////
+struct results
+{
+    double first_latency;    // average time until the first task started (us)
+    double last_latency;     // average time until the last task started (us)
+    double idle_cpu;         // CPU utilization while idle (0..1)
+};
+
+results measure(std::size_t rounds, std::size_t burst,
+    std::chrono::milliseconds idle_time)
+{
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    double first_latency = 0.0;
+    double last_latency = 0.0;
+    double idle_cpu = 0.0;
+
+    for (std::size_t r = 0; r != rounds; ++r)
+    {
+        // let all worker threads run out of work
+        hpx::chrono::high_resolution_timer idle_timer;
+        std::clock_t const cpu_start = std::clock();
+
+        hpx::this_thread::sleep_for(idle_time);
+
+        double const cpu_time = double(std::clock() - cpu_start) /
+            CLOCKS_PER_SEC;
+        idle_cpu += cpu_time / (idle_timer.elapsed() * os_threads);
+
+        // now spawn a burst of tasks, each of which records when it started
+        std::atomic<std::uint64_t> first(std::uint64_t(-1));
+        std::atomic<std::uint64_t> last(0);
+        hpx::lcos::local::latch l(std::ptrdiff_t(burst + 1));
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i != burst; ++i)
+        {
+            hpx::apply([&]() {
+                std::uint64_t const now =
+                    hpx::chrono::high_resolution_clock::now();
+
+                std::uint64_t f = first.load();
+                while (now < f && !first.compare_exchange_weak(f, now))
+                    ;
+
+                std::uint64_t t = last.load();
+                while (now > t && !last.compare_exchange_weak(t, now))
+                    ;
+
+                l.count_down(1);
+            });
+        }
+        l.count_down_and_wait();
+
+        first_latency += double(first.load() - start) / 1000.0;
+        last_latency += double(last.load() - start) / 1000.0;
+    }
+
+    return results{first_latency / double(rounds),
+        last_latency / double(rounds), idle_cpu / double(rounds)};
+}
+
+void print_results(char const* mode, results const& r)
+{
+    hpx::cout << mode << ": first task: " << r.first_latency
+              << " [us], last task: " << r.last_latency
+              << " [us], idle CPU utilization: " << r.idle_cpu * 100.0
+              << " [%]\n"
+              << hpx::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const rounds = vm["rounds"].as<std::size_t>();
+    std::size_t const burst = vm["burst"].as<std::size_t>();
+    std::chrono::milliseconds const idle_time(
+        vm["idle-time"].as<std::size_t>());
+
+    using namespace hpx::threads::policies;
+
+    hpx::threads::add_remove_scheduler_mode(
+        enable_idle_backoff, enable_idle_parking);
+    print_results("idle back-off", measure(rounds, burst, idle_time));
+
+    hpx::threads::add_remove_scheduler_mode(
+        enable_idle_parking, enable_idle_backoff);
+    print_results("idle parking ", measure(rounds, burst, idle_time));
+
+    hpx::threads::add_remove_scheduler_mode(
+        enable_idle_backoff, enable_idle_parking);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("rounds", value<std::size_t>()->default_value(20),
+         "number of idle periods followed by a burst of work (default: 20)")
+        ("burst", value<std::size_t>()->default_value(100),
+         "number of tasks spawned after each idle period (default: 100)")
+        ("idle-time", value<std::size_t>()->default_value(100),
+         "duration of each idle period in milliseconds (default: 100)")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv);
+}
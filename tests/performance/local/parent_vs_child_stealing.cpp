@@ -9,12 +9,14 @@
 #include <hpx/include/lcos.hpp>
 #include <hpx/iostream.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
 
 #include <hpx/modules/program_options.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <numeric>
+#include <string>
 #include <vector>
 
 #include "worker_timed.hpp"
@@ -83,15 +85,20 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (do_child)
         parent_stealing_time = measure(hpx::launch::fork);
 
+    // the scheduler allows to compare runs using different --hpx:queuing
+    std::string scheduler = hpx::get_config_entry("hpx.scheduler", "");
+
     if (print_header)
     {
         hpx::cout
-            << "num_cores,num_threads,child_stealing_time[s],parent_stealing_time[s]"
+            << "scheduler,num_cores,num_threads,child_stealing_time[s],"
+               "parent_stealing_time[s]"
             << hpx::endl;
     }
 
     hpx::util::format_to(hpx::cout,
-        "{},{},{},{}",
+        "{},{},{},{},{}",
+        scheduler,
         num_cores,
         iterations,
         child_stealing_time,
@@ -15,7 +15,8 @@
 // until reaching the root actor. (The answer should be 499999500000).
 
 // This code implements two versions of the skynet micro benchmark: a 'normal'
-// and a futurized one.
+// and a futurized one. Use --hpx:queuing to select the thread scheduler to
+// compare (for instance local-priority-fifo or work-stealing).
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/hpx.hpp>
@@ -83,6 +84,9 @@ skynet_f(std::int64_t num, std::int64_t size, std::int64_t div)
 ///////////////////////////////////////////////////////////////////////////////
 int main()
 {
+    hpx::cout << "Scheduler: " << hpx::get_config_entry("hpx.scheduler", "")
+              << "\n";
+
     {
         std::uint64_t t = hpx::chrono::high_resolution_clock::now();
 
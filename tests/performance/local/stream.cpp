@@ -20,6 +20,9 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/include/compute.hpp>
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/include/datapar.hpp>
+#endif
 #include <hpx/iostream.hpp>
 #include <hpx/include/parallel_copy.hpp>
 #include <hpx/include/parallel_executor_parameters.hpp>
@@ -250,6 +253,8 @@ void check_results(std::size_t iterations, Vector const& a_res,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+// The call operators return their argument type to allow for the vectorizing
+// execution policies to pass vector packs instead of single elements.
 template <typename T>
 struct multiply_step
 {
@@ -263,7 +268,7 @@ struct multiply_step
     //         (used in invoke()) to get the return type
 
     template <typename U>
-    HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(U val) const
+    HPX_HOST_DEVICE HPX_FORCEINLINE U operator()(U val) const
     {
         return val * factor_;
     }
@@ -279,7 +284,7 @@ struct add_step
     //         (used in invoke()) to get the return type
 
     template <typename U>
-    HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(U val1, U val2) const
+    HPX_HOST_DEVICE HPX_FORCEINLINE U operator()(U val1, U val2) const
     {
         return val1 + val2;
     }
@@ -298,7 +303,7 @@ struct triad_step
     //         (used in invoke()) to get the return type
 
     template <typename U>
-    HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(U val1, U val2) const
+    HPX_HOST_DEVICE HPX_FORCEINLINE U operator()(U val1, U val2) const
     {
         return val1 + val2 * factor_;
     }
@@ -505,11 +510,26 @@ int hpx_main(hpx::program_options::variables_map& vm)
             timing = run_benchmark<>(
                 iterations, vector_size, std::move(alloc), std::move(policy));
         }
+#if defined(HPX_HAVE_DATAPAR)
+        else if (executor == 3)
+        {
+            // Vectorizing parallel policy with serial allocator, compare with
+            // executor 0 to see the effect of vectorization.
+            timing = run_benchmark<>(iterations, vector_size,
+                std::allocator<STREAM_TYPE>{}, hpx::execution::datapar);
+        }
+        else
+        {
+            HPX_THROW_EXCEPTION(hpx::commandline_option_error, "hpx_main",
+                "Invalid executor id given (0-3 allowed");
+        }
+#else
         else
         {
             HPX_THROW_EXCEPTION(hpx::commandline_option_error, "hpx_main",
                 "Invalid executor id given (0-2 allowed");
         }
+#endif
     }
     time_total = mysecond() - time_total;
 
@@ -586,9 +606,16 @@ int main(int argc, char* argv[])
         (   "chunk_size",
              hpx::program_options::value<std::size_t>()->default_value(0),
             "size of vector (default: 1024)")
+#if defined(HPX_HAVE_DATAPAR)
+        (   "executor",
+            hpx::program_options::value<std::size_t>()->default_value(2),
+            "executor to use (0-3, 3: vectorizing datapar policy) "
+            "(default: 2, parallel_executor)")
+#else
         (   "executor",
             hpx::program_options::value<std::size_t>()->default_value(2),
             "executor to use (0-2) (default: 2, parallel_executor)")
+#endif
 
 #if defined(HPX_HAVE_COMPUTE)
         (   "use-accelerator",
@@ -4,15 +4,25 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+// The effect of contention on the outgoing parcel queues can be observed by
+// running this with several senders and by printing the parcelport counters,
+// for instance:
+//
+//      --senders=16 --hpx:print-counter=/parcelport/count/tcp/queue-contentions
+//      --hpx:print-counter=/parcelport/count/tcp/enqueued
+
 #include <hpx/hpx_init.hpp>
 #include <hpx/hpx.hpp>
 #include <hpx/iostream.hpp>
 #include <hpx/include/async.hpp>
 #include <hpx/include/serialization.hpp>
+#include <hpx/modules/timing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <complex>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace pingpong
@@ -34,10 +44,13 @@ int hpx_main(hpx::program_options::variables_map& vm)
 {
    //Commandline specific code
     std::size_t const n = vm["nparcels"].as<std::size_t>();
+    std::size_t const senders = (std::max)(
+        vm["senders"].as<std::size_t>(), std::size_t(1));
 
     if (0 == hpx::get_locality_id())
     {
-        hpx::cout << "Running With nparcel = " << n << "\n" << hpx::flush;
+        hpx::cout << "Running With nparcel = " << n
+                  << ", senders = " << senders << "\n" << hpx::flush;
     }
 
     //Create instance of the actions
@@ -50,23 +63,52 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::vector<hpx::naming::id_type> dummy = hpx::find_remote_localities();
     hpx::naming::id_type other_locality = dummy[0];
 
+    hpx::chrono::high_resolution_timer t;
 
-    for(std::size_t i=0; i<n; ++i)
+    // Every sender issues its share of the parcels concurrently with all
+    // other senders, this exercises the outgoing parcel queues.
+    std::vector<hpx::future<std::vector<hpx::future<std::complex<double>>>>>
+        sent;
+    sent.reserve(senders);
+    for (std::size_t s = 0; s != senders; ++s)
     {
-        vec.push_back(hpx::async(act,other_locality));
+        std::size_t const count = n / senders + (s < n % senders ? 1 : 0);
+        sent.push_back(hpx::async([act, other_locality, count]()
+            {
+                std::vector<hpx::future<std::complex<double>>> v;
+                v.reserve(count);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    v.push_back(hpx::async(act, other_locality));
+                }
+                return v;
+            }));
+    }
+
+    for (auto& f : sent)
+    {
+        for (auto& r : f.get())
+        {
+            vec.push_back(std::move(r));
+        }
     }
 
     hpx::when_all(vec).then(
-        [&received, n](hpx::future<std::vector<hpx::future<std::complex<double>>>> dummy)
+        [&received, &t, n](hpx::future<std::vector<hpx::future<std::complex<double>>>> dummy)
         {
             std::vector<hpx::future<std::complex<double>>> number = dummy.get();
             for (std::size_t i = 0; i < n; ++i)
             {
                 received.push_back(number[i].get());
             }
+            double const elapsed = t.elapsed();
+
             hpx::evaluate_active_counters(false, " All Futures Done");
             hpx::cout << "Now Done With Lambda and the last received value is "
-                      <<received[n-1]<< "\n" << hpx::flush;
+                      <<received[n-1]<< "\n"
+                      << "Elapsed time [s]: " << elapsed << ", throughput "
+                      << "[parcels/s]: " << (elapsed != 0. ? n / elapsed : 0.)
+                      << "\n" << hpx::flush;
         }
     ).get();
     return hpx::finalize();
@@ -82,6 +124,9 @@ int main(int argc, char* argv[])
         ("nparcels,n",
          hpx::program_options::value<std::size_t>()->default_value(100),
          "the number of parcels to create")
+        ("senders",
+         hpx::program_options::value<std::size_t>()->default_value(1),
+         "the number of tasks concurrently sending the parcels")
         ;
     // Initialize and run HPX
     std::vector<std::string> cfg;